@@ -1,274 +1,437 @@
-#pragma once
-
-#include "Sequence.hpp"
-#include "DynamicArray.hpp"
-#include "error.hpp"
-#include <stdexcept>
-
-template <typename T>
-class MutableArraySequence : public Sequence<T> {
-protected:
-    int size;
-    DynamicArray<T>* items;
-
-    Sequence<T>* CreateFromArray(DynamicArray<T>* array) const;
-
-public:
-    MutableArraySequence();
-    MutableArraySequence(T* arr, int count);
-    MutableArraySequence(const MutableArraySequence<T>& other);
-    MutableArraySequence(const DynamicArray<T>& array);
-    ~MutableArraySequence() override;
-
-    T GetFirst() const override;
-    T GetLast() const override;
-    T Get(int index) const override;
-    int GetLength() const override;
-    T* GetRef(int index) const;
-
-    Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
-    Sequence<T>* Concat(const Sequence<T>* other) const override;
-
-    Sequence<T>* Append(T item) override;
-    Sequence<T>* Prepend(T item) override;
-    Sequence<T>* InsertAt(T item, int index) override;
-    Sequence<T>* Remove(int index) override;
-
-    Sequence<T>* Instance() override;
-    Sequence<T>* Clone() const override;
-};
-
-template <typename T>
-MutableArraySequence<T>::MutableArraySequence() {
-    items = new DynamicArray<T>(0);
-    size = 0;
-}
-
-template <typename T>
-MutableArraySequence<T>::MutableArraySequence(T* arr, int count) {
-    items = new DynamicArray<T>(arr, count);
-    size = count;
-}
-
-template <typename T>
-MutableArraySequence<T>::MutableArraySequence(const MutableArraySequence<T>& other) {
-    items = new DynamicArray<T>(*other.items);
-    size = other.size;
-}
-
-template <typename T>
-MutableArraySequence<T>::MutableArraySequence(const DynamicArray<T>& array) {
-    items = new DynamicArray<T>(array);
-    size = array.GetSize();
-}
-
-template <typename T>
-MutableArraySequence<T>::~MutableArraySequence() {
-    delete items;
-}
-
-template <typename T>
-T MutableArraySequence<T>::GetFirst() const {
-    if (GetLength() == 0) throw Errors::EmptyArray();
-    return items->Get(0);
-}
-
-template <typename T>
-T MutableArraySequence<T>::GetLast() const {
-    if (GetLength() == 0) throw Errors::EmptyArray();
-    return items->Get(GetLength() - 1);
-}
-
-template <typename T>
-T MutableArraySequence<T>::Get(int index) const {
-    return items->Get(index);
-}
-
-template <typename T>
-int MutableArraySequence<T>::GetLength() const {
-    return size;
-}
-
-template <typename T>
-T* MutableArraySequence<T>::GetRef(int index) const {
-    return items->GetRef(index);
-}
-
-template <typename T>
-Sequence<T>* MutableArraySequence<T>::GetSubsequence(int startIndex, int endIndex) const {
-    DynamicArray<T>* sub = items->GetSubArray(startIndex, endIndex);
-    auto* result = new MutableArraySequence<T>(*sub);
-    delete sub;
-    return result;
-}
-
-template <typename T>
-Sequence<T>* MutableArraySequence<T>::Concat(const Sequence<T>* other) const {
-    auto otherArray = dynamic_cast<const MutableArraySequence<T>*>(other);
-    if (!otherArray) throw Errors::IncompatibleTypes();
-
-    int totalSize = GetLength() + otherArray->GetLength();
-    DynamicArray<T>* result = new DynamicArray<T>(totalSize);
-
-    for (int i = 0; i < GetLength(); i++) result->Set(i, items->Get(i));
-    for (int j = 0; j < otherArray->GetLength(); j++) result->Set(j + GetLength(), otherArray->Get(j));
-
-    return CreateFromArray(result);
-}
-
-template <typename T>
-Sequence<T>* MutableArraySequence<T>::Append(T item) {
-    int capasity = items->GetSize();
-
-    if (size + 1 > capasity) items->Resize(size == 0 ? 10 : size + int(size / 2));
-
-    items->Set(size, item);
-
-    size++;
-
-    return this;
-}
-
-template <typename T>
-Sequence<T>* MutableArraySequence<T>::Prepend(T item) {
-    DynamicArray<T>* tempData = new DynamicArray<T>(size + 1);
-
-    int capasity = items->GetSize();
-
-    if (size + 1 > capasity) items->Resize(size == 0 ? 10 : size + int(size / 2));
-
-    for (int i = 0; i < size; ++i)
-        tempData->Set(i + 1, items->Get(i));
-
-    tempData->Set(0, item);
-
-    delete items;
-    items = tempData;
-
-    size++;
-    return this;
-}
-
-template <typename T>
-Sequence<T>* MutableArraySequence<T>::InsertAt(T item, int index) {
-    
-    int capacity = items->GetSize();
-
-    if (index < 0 || index > size) throw Errors::IndexOutOfRange();
-
-    if (capacity < size + 1) items->Resize(size == 0 ? 10 : size + int(size / 2));
-    for (int i = size; i > index; i--)
-        items->Set(i, items->Get(i - 1));
-    items->Set(index, item);
-    size++;
-    return this;
-}
-
-template <typename T>
-Sequence<T>* MutableArraySequence<T>::Remove(int index) {
-    if (items->GetSize() == 0) throw Errors::EmptyArray();
-    size--;
-    return this;
-}
-
-template <typename T>
-Sequence<T>* MutableArraySequence<T>::Instance() {
-    return this;
-}
-
-template <typename T>
-Sequence<T>* MutableArraySequence<T>::Clone() const {
-    return new MutableArraySequence<T>(*this);
-}
-
-template <typename T>
-Sequence<T>* MutableArraySequence<T>::CreateFromArray(DynamicArray<T>* array) const {
-    return new MutableArraySequence<T>(*array);
-}
-
-template <typename T>
-MutableArraySequence<T> operator+(const MutableArraySequence<T>& lhs, const MutableArraySequence<T>& rhs) {
-    Sequence<T>* resultBase = lhs.Concat(&rhs);
-    auto* result = static_cast<MutableArraySequence<T>*>(resultBase);
-    MutableArraySequence<T> copy(*result);
-    delete result;
-    return copy;
-}
-
-
-template <typename T>
-class ImmutableArraySequence : public MutableArraySequence<T> {
-public:
-    using MutableArraySequence<T>::MutableArraySequence;
-
-    Sequence<T>* Concat(const Sequence<T>* other) const override;
-    Sequence<T>* Append(T item) override;
-    Sequence<T>* Prepend(T item) override;
-    Sequence<T>* InsertAt(T item, int index) override;
-    Sequence<T>* Remove(int index) override;
-
-    Sequence<T>* Instance() override;
-    Sequence<T>* Clone() const override;
-};
-
-template <typename T>
-Sequence<T>* ImmutableArraySequence<T>::Concat(const Sequence<T>* other) const {
-    const auto* otherArr = dynamic_cast<const ImmutableArraySequence<T>*>(other);
-    if (!otherArr) throw Errors::IncompatibleTypes();
-
-    int totalSize = this->GetLength() + otherArr->GetLength();
-    DynamicArray<T> combined(totalSize);
-
-    for (int i = 0; i < this->GetLength(); ++i)
-        combined.Set(i, this->Get(i));
-    for (int j = 0; j < otherArr->GetLength(); ++j)
-        combined.Set(j + this->GetLength(), otherArr->Get(j));
-
-    return new ImmutableArraySequence<T>(combined);
-}
-
-template <typename T>
-Sequence<T>* ImmutableArraySequence<T>::Append(T item) {
-    auto* clone = new ImmutableArraySequence<T>(*this);
-    clone->MutableArraySequence<T>::Append(item);
-    return clone;
-}
-
-template <typename T>
-Sequence<T>* ImmutableArraySequence<T>::Prepend(T item) {
-    auto* clone = new ImmutableArraySequence<T>(*this);
-    clone->MutableArraySequence<T>::Prepend(item);
-    return clone;
-}
-
-template <typename T>
-Sequence<T>* ImmutableArraySequence<T>::InsertAt(T item, int index) {
-    auto* clone = new ImmutableArraySequence<T>(*this);
-    clone->MutableArraySequence<T>::InsertAt(item, index);
-    return clone;
-}
-
-template <typename T>
-Sequence<T>* ImmutableArraySequence<T>::Remove(int index) {
-    return this->Clone()->Remove(index);
-}
-
-template <typename T>
-Sequence<T>* ImmutableArraySequence<T>::Instance() {
-    return this->Clone();
-}
-
-template <typename T>
-Sequence<T>* ImmutableArraySequence<T>::Clone() const {
-    return new ImmutableArraySequence<T>(*this);
-}
-
-template <typename T>
-ImmutableArraySequence<T> operator+(const ImmutableArraySequence<T>& lhs, const ImmutableArraySequence<T>& rhs) {
-    Sequence<T>* resultBase = lhs.Concat(&rhs);
-    auto* result = dynamic_cast<ImmutableArraySequence<T>*>(resultBase);
-    if (!result) throw std::runtime_error("Invalid Concat result type");
-    ImmutableArraySequence<T> copy(*result);
-    delete result;
-    return copy;
+#pragma once
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "Sort.hpp"
+#include "error.hpp"
+#include <functional>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <stdexcept>
+
+// Storages with Reserve() (MmapDynamicArray) keep their own item count, which
+// must match the sequence length: they grow through Reserve() and are resized
+// to the length on every change. Otherwise the storage size is the capacity.
+template <class Storage, class = void>
+struct StorageKeepsLength : std::false_type {};
+template <class Storage>
+struct StorageKeepsLength<Storage, std::void_t<decltype(std::declval<Storage&>().Reserve(0))>> : std::true_type {};
+
+// Grow and shift logic shared by MutableArraySequence and ArrayCore. The
+// callers check bounds and own the length; these only touch the storage.
+namespace ArrayStorage {
+
+    template <class Storage>
+    int GetCapacity(const Storage& items) {
+        if constexpr (StorageKeepsLength<Storage>::value) return items.GetCapacity();
+        else return items.GetSize();
+    }
+
+    // Makes room for capacity items so the following Appends do not reallocate.
+    template <class Storage>
+    void Reserve(Storage& items, int capacity) {
+        if (capacity <= GetCapacity(items)) return;
+        if constexpr (StorageKeepsLength<Storage>::value) items.Reserve(capacity);
+        else items.Resize(capacity);
+    }
+
+    // Makes room for at least count items, growing by half so Appends stay
+    // amortized O(1).
+    template <class Storage>
+    void Grow(Storage& items, int size, int count) {
+        if (count <= GetCapacity(items)) return;
+        int capacity = size == 0 ? 10 : size + int(size / 2) + 1;
+        Reserve(items, capacity < count ? count : capacity);
+    }
+
+    // Called before the new items are written: resizing a length-keeping
+    // storage zero-fills what it adds.
+    template <class Storage>
+    void SetLength(Storage& items, int& size, int newSize) {
+        if constexpr (StorageKeepsLength<Storage>::value) items.Resize(newSize);
+        size = newSize;
+    }
+
+    template <class Storage, class T>
+    void InsertAt(Storage& items, int& size, T&& item, int index) {
+        Grow(items, size, size + 1);
+        SetLength(items, size, size + 1);
+        auto* data = items.Data();
+        for (int i = size - 1; i > index; i--)
+            data[i] = std::move(data[i - 1]);
+        data[index] = std::forward<T>(item);
+    }
+
+    template <class Storage>
+    void RemoveAt(Storage& items, int& size, int index) {
+        auto* data = items.Data();
+        for (int i = index; i < size - 1; i++)
+            data[i] = std::move(data[i + 1]);
+        SetLength(items, size, size - 1);
+    }
+
+    // Drops the spare capacity Append leaves behind.
+    template <class Storage>
+    void ShrinkToFit(Storage& items, int size) {
+        if constexpr (!StorageKeepsLength<Storage>::value) items.Resize(size);
+    }
+}
+
+template <typename T, class Policy = Checked, class Storage = DynamicArray<T, Policy>>
+class MutableArraySequence : public Sequence<T> {
+protected:
+    int size;
+    Storage items;
+
+    Sequence<T>* CreateFromArray(DynamicArray<T, Policy>&& array) const;
+
+public:
+    MutableArraySequence();
+    explicit MutableArraySequence(int count);
+    explicit MutableArraySequence(std::pmr::memory_resource* resource);
+    MutableArraySequence(const T* arr, int count, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    MutableArraySequence(const MutableArraySequence<T, Policy, Storage>& other);
+    MutableArraySequence(MutableArraySequence<T, Policy, Storage>&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    MutableArraySequence(const Storage& array);
+    MutableArraySequence(Storage&& array);
+    ~MutableArraySequence() override;
+
+    MutableArraySequence<T, Policy, Storage>& operator=(const MutableArraySequence<T, Policy, Storage>& other);
+    MutableArraySequence<T, Policy, Storage>& operator=(MutableArraySequence<T, Policy, Storage>&& other);
+
+    T GetFirst() const override;
+    T GetLast() const override;
+    T Get(int index) const override;
+    Result<T> TryGetFirst() const override;
+    Result<T> TryGetLast() const override;
+    Result<T> TryGet(int index) const override;
+    int GetLength() const override;
+    T* GetRef(int index) const;
+    T& At(int index);
+    const T& At(int index) const override;
+    T* Data();
+    const T* Data() const;
+    std::pmr::memory_resource* GetResource() const { return items.GetResource(); }
+    void Reserve(int capacity);
+    void ShrinkToFit();
+
+    Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
+    Sequence<T>* Concat(const Sequence<T>* other) const override;
+
+    Sequence<T>* Append(T item) override;
+    Sequence<T>* Prepend(T item) override;
+    Sequence<T>* InsertAt(T item, int index) override;
+    Sequence<T>* Remove(int index) override;
+
+    Sequence<T>* Instance() override;
+    Sequence<T>* Clone() const override;
+
+    template <class Compare = std::less<T>>
+    void Sort(Compare cmp = Compare());
+    template <class KeyFn>
+    void SortByKey(KeyFn key);
+};
+
+template <typename T, class Policy, class Storage>
+MutableArraySequence<T, Policy, Storage>::MutableArraySequence() : size(0), items(0) {}
+
+template <typename T, class Policy, class Storage>
+MutableArraySequence<T, Policy, Storage>::MutableArraySequence(int count) : size(count), items(count) {}
+
+template <typename T, class Policy, class Storage>
+MutableArraySequence<T, Policy, Storage>::MutableArraySequence(std::pmr::memory_resource* resource) : size(0), items(0, resource) {}
+
+template <typename T, class Policy, class Storage>
+MutableArraySequence<T, Policy, Storage>::MutableArraySequence(const T* arr, int count, std::pmr::memory_resource* resource)
+    : size(count), items(arr, count, resource) {}
+
+template <typename T, class Policy, class Storage>
+MutableArraySequence<T, Policy, Storage>::MutableArraySequence(const MutableArraySequence<T, Policy, Storage>& other)
+    : size(other.size), items(other.items.Data(), other.size) {}
+
+template <typename T, class Policy, class Storage>
+MutableArraySequence<T, Policy, Storage>::MutableArraySequence(MutableArraySequence<T, Policy, Storage>&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    : size(other.size), items(std::move(other.items)) {
+    other.size = 0;
+}
+
+template <typename T, class Policy, class Storage>
+MutableArraySequence<T, Policy, Storage>::MutableArraySequence(const Storage& array) : size(array.GetSize()), items(array) {}
+
+template <typename T, class Policy, class Storage>
+MutableArraySequence<T, Policy, Storage>::MutableArraySequence(Storage&& array) : size(array.GetSize()), items(std::move(array)) {}
+
+template <typename T, class Policy, class Storage>
+MutableArraySequence<T, Policy, Storage>& MutableArraySequence<T, Policy, Storage>::operator=(const MutableArraySequence<T, Policy, Storage>& other) {
+    if (this == &other) return *this;
+    items = Storage(other.items.Data(), other.size, items.GetResource());
+    size = other.size;
+    return *this;
+}
+
+template <typename T, class Policy, class Storage>
+MutableArraySequence<T, Policy, Storage>& MutableArraySequence<T, Policy, Storage>::operator=(MutableArraySequence<T, Policy, Storage>&& other) {
+    if (this == &other) return *this;
+    items = std::move(other.items);
+    size = other.size;
+    other.size = 0;
+    return *this;
+}
+
+template <typename T, class Policy, class Storage>
+MutableArraySequence<T, Policy, Storage>::~MutableArraySequence() = default;
+
+template <typename T, class Policy, class Storage>
+T MutableArraySequence<T, Policy, Storage>::GetFirst() const {
+    Policy::Require(size != 0, ErrorCode::EMPTY_ARRAY);
+    return items.Data()[0];
+}
+
+template <typename T, class Policy, class Storage>
+T MutableArraySequence<T, Policy, Storage>::GetLast() const {
+    Policy::Require(size != 0, ErrorCode::EMPTY_ARRAY);
+    return items.Data()[size - 1];
+}
+
+template <typename T, class Policy, class Storage>
+T MutableArraySequence<T, Policy, Storage>::Get(int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    return items.Data()[index];
+}
+
+template <typename T, class Policy, class Storage>
+Result<T> MutableArraySequence<T, Policy, Storage>::TryGetFirst() const {
+    if (size == 0) return ErrorCode::EMPTY_ARRAY;
+    return items.TryGet(0);
+}
+
+template <typename T, class Policy, class Storage>
+Result<T> MutableArraySequence<T, Policy, Storage>::TryGetLast() const {
+    if (size == 0) return ErrorCode::EMPTY_ARRAY;
+    return items.TryGet(size - 1);
+}
+
+template <typename T, class Policy, class Storage>
+Result<T> MutableArraySequence<T, Policy, Storage>::TryGet(int index) const {
+    if (index < 0 || index >= size) return ErrorCode::INDEX_OUT_OF_RANGE;
+    return items.TryGet(index);
+}
+
+template <typename T, class Policy, class Storage>
+int MutableArraySequence<T, Policy, Storage>::GetLength() const {
+    return size;
+}
+
+template <typename T, class Policy, class Storage>
+T* MutableArraySequence<T, Policy, Storage>::GetRef(int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    return const_cast<T*>(items.Data()) + index;
+}
+
+template <typename T, class Policy, class Storage>
+T& MutableArraySequence<T, Policy, Storage>::At(int index) {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    return items.Data()[index];
+}
+
+template <typename T, class Policy, class Storage>
+const T& MutableArraySequence<T, Policy, Storage>::At(int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    return items.Data()[index];
+}
+
+template <typename T, class Policy, class Storage>
+T* MutableArraySequence<T, Policy, Storage>::Data() {
+    return items.Data();
+}
+
+template <typename T, class Policy, class Storage>
+const T* MutableArraySequence<T, Policy, Storage>::Data() const {
+    return items.Data();
+}
+
+template <typename T, class Policy, class Storage>
+void MutableArraySequence<T, Policy, Storage>::Reserve(int capacity) {
+    ArrayStorage::Reserve(items, capacity);
+}
+
+template <typename T, class Policy, class Storage>
+void MutableArraySequence<T, Policy, Storage>::ShrinkToFit() {
+    ArrayStorage::ShrinkToFit(items, size);
+}
+
+template <typename T, class Policy, class Storage>
+Sequence<T>* MutableArraySequence<T, Policy, Storage>::GetSubsequence(int startIndex, int endIndex) const {
+    Policy::Require(startIndex >= 0 && endIndex < size && startIndex <= endIndex, ErrorCode::INVALID_INDICES);
+    return new MutableArraySequence<T, Policy>(items.Data() + startIndex, endIndex - startIndex + 1);
+}
+
+template <typename T, class Policy, class Storage>
+Sequence<T>* MutableArraySequence<T, Policy, Storage>::Concat(const Sequence<T>* other) const {
+    auto otherArray = dynamic_cast<const MutableArraySequence<T, Policy, Storage>*>(other);
+    if (!otherArray) throw Errors::IncompatibleTypes();
+
+    int totalSize = GetLength() + otherArray->GetLength();
+    DynamicArray<T, Policy> result(totalSize);
+
+    T* target = result.Data();
+    const T* source = items.Data();
+    const T* otherSource = otherArray->items.Data();
+    for (int i = 0; i < size; i++) target[i] = source[i];
+    for (int j = 0; j < otherArray->size; j++) target[j + size] = otherSource[j];
+
+    return CreateFromArray(std::move(result));
+}
+
+template <typename T, class Policy, class Storage>
+Sequence<T>* MutableArraySequence<T, Policy, Storage>::Append(T item) {
+    ArrayStorage::InsertAt(items, size, std::move(item), size);
+    return this;
+}
+
+template <typename T, class Policy, class Storage>
+Sequence<T>* MutableArraySequence<T, Policy, Storage>::Prepend(T item) {
+    return InsertAt(item, 0);
+}
+
+template <typename T, class Policy, class Storage>
+Sequence<T>* MutableArraySequence<T, Policy, Storage>::InsertAt(T item, int index) {
+    Policy::Require(index >= 0 && index <= size, ErrorCode::INDEX_OUT_OF_RANGE);
+    ArrayStorage::InsertAt(items, size, std::move(item), index);
+    return this;
+}
+
+template <typename T, class Policy, class Storage>
+Sequence<T>* MutableArraySequence<T, Policy, Storage>::Remove(int index) {
+    Policy::Require(size != 0, ErrorCode::EMPTY_ARRAY);
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    ArrayStorage::RemoveAt(items, size, index);
+    return this;
+}
+
+template <typename T, class Policy, class Storage>
+Sequence<T>* MutableArraySequence<T, Policy, Storage>::Instance() {
+    return this;
+}
+
+template <typename T, class Policy, class Storage>
+Sequence<T>* MutableArraySequence<T, Policy, Storage>::Clone() const {
+    return new MutableArraySequence<T, Policy>(items.Data(), size);
+}
+
+// Unstable; large sequences are sorted on DefaultPool().
+template <typename T, class Policy, class Storage>
+template <class Compare>
+void MutableArraySequence<T, Policy, Storage>::Sort(Compare cmp) {
+    if (size >= Sorting::ParallelThreshold && DefaultPool().GetThreadCount() > 1)
+        Sorting::ParallelSort(items.Data(), size, cmp, DefaultPool());
+    else
+        Sorting::IntroSort(items.Data(), size, cmp);
+}
+
+// Stable radix sort by an integral key, e.g. [](const Student& s) { return s.id; }.
+template <typename T, class Policy, class Storage>
+template <class KeyFn>
+void MutableArraySequence<T, Policy, Storage>::SortByKey(KeyFn key) {
+    Sorting::RadixSort(items.Data(), size, key);
+}
+
+template <typename T, class Policy, class Storage>
+Sequence<T>* MutableArraySequence<T, Policy, Storage>::CreateFromArray(DynamicArray<T, Policy>&& array) const {
+    return new MutableArraySequence<T, Policy>(std::move(array));
+}
+
+template <typename T, class Policy>
+MutableArraySequence<T, Policy> operator+(const MutableArraySequence<T, Policy>& lhs, const MutableArraySequence<T, Policy>& rhs) {
+    Sequence<T>* resultBase = lhs.Concat(&rhs);
+    auto* result = static_cast<MutableArraySequence<T, Policy>*>(resultBase);
+    MutableArraySequence<T, Policy> copy(*result);
+    delete result;
+    return copy;
+}
+
+
+template <typename T, class Policy = Checked>
+class ImmutableArraySequence : public MutableArraySequence<T, Policy> {
+public:
+    using MutableArraySequence<T, Policy>::MutableArraySequence;
+    using MutableArraySequence<T, Policy>::At;
+
+    T& At(int index) = delete;
+    template <class Compare = std::less<T>>
+    void Sort(Compare cmp = Compare()) = delete;
+    template <class KeyFn>
+    void SortByKey(KeyFn key) = delete;
+
+    Sequence<T>* Concat(const Sequence<T>* other) const override;
+    Sequence<T>* Append(T item) override;
+    Sequence<T>* Prepend(T item) override;
+    Sequence<T>* InsertAt(T item, int index) override;
+    Sequence<T>* Remove(int index) override;
+
+    Sequence<T>* Instance() override;
+    Sequence<T>* Clone() const override;
+};
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableArraySequence<T, Policy>::Concat(const Sequence<T>* other) const {
+    const auto* otherArr = dynamic_cast<const ImmutableArraySequence<T, Policy>*>(other);
+    if (!otherArr) throw Errors::IncompatibleTypes();
+
+    int totalSize = this->GetLength() + otherArr->GetLength();
+    DynamicArray<T, Policy> combined(totalSize);
+
+    for (int i = 0; i < this->GetLength(); ++i)
+        combined.Set(i, this->Get(i));
+    for (int j = 0; j < otherArr->GetLength(); ++j)
+        combined.Set(j + this->GetLength(), otherArr->Get(j));
+
+    return new ImmutableArraySequence<T, Policy>(combined);
+}
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableArraySequence<T, Policy>::Append(T item) {
+    auto* clone = new ImmutableArraySequence<T, Policy>(*this);
+    clone->MutableArraySequence<T, Policy>::Append(item);
+    return clone;
+}
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableArraySequence<T, Policy>::Prepend(T item) {
+    auto* clone = new ImmutableArraySequence<T, Policy>(*this);
+    clone->MutableArraySequence<T, Policy>::Prepend(item);
+    return clone;
+}
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableArraySequence<T, Policy>::InsertAt(T item, int index) {
+    auto* clone = new ImmutableArraySequence<T, Policy>(*this);
+    clone->MutableArraySequence<T, Policy>::InsertAt(item, index);
+    return clone;
+}
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableArraySequence<T, Policy>::Remove(int index) {
+    return this->Clone()->Remove(index);
+}
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableArraySequence<T, Policy>::Instance() {
+    return this->Clone();
+}
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableArraySequence<T, Policy>::Clone() const {
+    return new ImmutableArraySequence<T, Policy>(*this);
+}
+
+template <typename T, class Policy>
+ImmutableArraySequence<T, Policy> operator+(const ImmutableArraySequence<T, Policy>& lhs, const ImmutableArraySequence<T, Policy>& rhs) {
+    Sequence<T>* resultBase = lhs.Concat(&rhs);
+    auto* result = dynamic_cast<ImmutableArraySequence<T, Policy>*>(resultBase);
+    if (!result) throw std::runtime_error("Invalid Concat result type");
+    ImmutableArraySequence<T, Policy> copy(*result);
+    delete result;
+    return copy;
 }
\ No newline at end of file
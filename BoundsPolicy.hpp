@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cassert>
+
+#include "error.hpp"
+
+// Bounds-check policies for DynamicArray, LinkedList and the sequences.
+// Checked throws like the rest of the library, DebugAssert only checks in
+// builds without NDEBUG, Unchecked compiles the check away entirely.
+
+struct Checked {
+    static constexpr void Require(bool condition, ErrorCode code) {
+        if (!condition) Errors::Throw(code);
+    }
+};
+
+struct DebugAssert {
+    static constexpr void Require(bool condition, ErrorCode) noexcept {
+        assert(condition);
+        (void)condition;
+    }
+};
+
+struct Unchecked {
+    static constexpr void Require(bool, ErrorCode) noexcept {}
+};
\ No newline at end of file
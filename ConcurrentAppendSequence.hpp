@@ -0,0 +1,219 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "error.hpp"
+#include "DynamicArray.hpp"
+#include "ArraySequence.hpp"
+
+// A sequence that many threads can Append to at once. Items go into shards,
+// each a chain of fixed-size chunks. An appender takes its home shard (picked
+// by thread), or the first free one if another thread holds it, so threads
+// only wait on each other when every shard is busy. An item is published by a
+// release store of its chunk's count, and chunks are never moved or freed
+// while the sequence lives, so readers walk the chains without any lock.
+//
+// Snapshot() copies every published item into a MutableArraySequence:
+// grouped by shard, each shard in its own append order. With
+// Ordering::ORDERED every Append also draws a ticket from one shared counter,
+// and Snapshot() returns the items in ticket order, up to the first Append
+// that is still in flight. The shared counter is the price of the order.
+
+template <class T>
+class ConcurrentAppendSequence {
+public:
+    enum class Ordering { UNORDERED = 1, ORDERED };
+
+private:
+    struct Chunk {
+        std::atomic<Chunk*> next;
+        std::atomic<int> count;
+        T* items;
+        long long* tickets;
+    };
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::atomic<Chunk*> head{ nullptr };
+        Chunk* tail = nullptr;
+    };
+
+    int shardCount;
+    int chunkSize;
+    Ordering ordering;
+    std::unique_ptr<Shard[]> shards;
+    std::atomic<long long> nextTicket;
+
+    static int ThreadOrdinal();
+    Chunk* NewChunk();
+    void FreeChunk(Chunk* chunk) noexcept;
+
+    template <class U>
+    void Emplace(U&& item);
+
+    // visit(item, ticket) for every published item, shard by shard.
+    template <class F>
+    void ForEachPublished(F visit) const;
+
+public:
+    explicit ConcurrentAppendSequence(int shards = static_cast<int>(std::thread::hardware_concurrency()),
+        Ordering ordering = Ordering::UNORDERED, int chunkSize = 1024);
+    ConcurrentAppendSequence(const ConcurrentAppendSequence<T>&) = delete;
+    ConcurrentAppendSequence<T>& operator=(const ConcurrentAppendSequence<T>&) = delete;
+    ~ConcurrentAppendSequence();
+
+    void Append(const T& item) { Emplace(item); }
+    void Append(T&& item) { Emplace(std::move(item)); }
+
+    // Items published so far; may lag appends running concurrently.
+    int GetLength() const;
+    int GetShardCount() const { return shardCount; }
+    Ordering GetOrdering() const { return ordering; }
+
+    MutableArraySequence<T> Snapshot() const;
+};
+
+template <class T>
+int ConcurrentAppendSequence<T>::ThreadOrdinal() {
+    static std::atomic<int> threads{ 0 };
+    thread_local int ordinal = threads.fetch_add(1, std::memory_order_relaxed);
+    return ordinal;
+}
+
+template <class T>
+ConcurrentAppendSequence<T>::ConcurrentAppendSequence(int shards, Ordering ordering, int chunkSize)
+    : shardCount(shards < 1 ? 1 : shards), chunkSize(chunkSize), ordering(ordering), nextTicket(0) {
+    if (chunkSize < 1) throw Errors::InvalidArgument("chunk size must be positive");
+    this->shards.reset(new Shard[shardCount]);
+}
+
+template <class T>
+ConcurrentAppendSequence<T>::~ConcurrentAppendSequence() {
+    for (int s = 0; s < shardCount; s++) {
+        Chunk* chunk = shards[s].head.load(std::memory_order_relaxed);
+        while (chunk != nullptr) {
+            Chunk* next = chunk->next.load(std::memory_order_relaxed);
+            FreeChunk(chunk);
+            chunk = next;
+        }
+    }
+}
+
+template <class T>
+typename ConcurrentAppendSequence<T>::Chunk* ConcurrentAppendSequence<T>::NewChunk() {
+    std::unique_ptr<Chunk> chunk(new Chunk{ { nullptr }, { 0 }, nullptr, nullptr });
+    chunk->items = static_cast<T*>(::operator new(sizeof(T) * std::size_t(chunkSize), std::align_val_t(alignof(T))));
+    if (ordering == Ordering::ORDERED) {
+        try {
+            chunk->tickets = new long long[chunkSize];
+        }
+        catch (...) {
+            ::operator delete(chunk->items, std::align_val_t(alignof(T)));
+            throw;
+        }
+    }
+    return chunk.release();
+}
+
+template <class T>
+void ConcurrentAppendSequence<T>::FreeChunk(Chunk* chunk) noexcept {
+    int count = chunk->count.load(std::memory_order_relaxed);
+    for (int i = 0; i < count; i++) chunk->items[i].~T();
+    ::operator delete(chunk->items, std::align_val_t(alignof(T)));
+    delete[] chunk->tickets;
+    delete chunk;
+}
+
+template <class T>
+template <class U>
+void ConcurrentAppendSequence<T>::Emplace(U&& item) {
+    int home = ThreadOrdinal() % shardCount;
+    Shard* shard = &shards[home];
+    std::unique_lock<std::mutex> lock(shard->mutex, std::try_to_lock);
+    for (int i = 1; i < shardCount && !lock.owns_lock(); i++) {
+        shard = &shards[(home + i) % shardCount];
+        lock = std::unique_lock<std::mutex>(shard->mutex, std::try_to_lock);
+    }
+    if (!lock.owns_lock()) {
+        shard = &shards[home];
+        lock = std::unique_lock<std::mutex>(shard->mutex);
+    }
+
+    Chunk* chunk = shard->tail;
+    int used = chunk != nullptr ? chunk->count.load(std::memory_order_relaxed) : 0;
+    if (chunk == nullptr || used == chunkSize) {
+        Chunk* fresh = NewChunk();
+        if (chunk != nullptr) chunk->next.store(fresh, std::memory_order_release);
+        else shard->head.store(fresh, std::memory_order_release);
+        shard->tail = chunk = fresh;
+        used = 0;
+    }
+
+    new (chunk->items + used) T(std::forward<U>(item));
+    // Drawn after the item exists, so a throwing copy leaves no gap.
+    if (ordering == Ordering::ORDERED) chunk->tickets[used] = nextTicket.fetch_add(1, std::memory_order_relaxed);
+    chunk->count.store(used + 1, std::memory_order_release);
+}
+
+// A chunk with a successor was full before the successor was linked, so its
+// count need not be read.
+template <class T>
+template <class F>
+void ConcurrentAppendSequence<T>::ForEachPublished(F visit) const {
+    for (int s = 0; s < shardCount; s++) {
+        Chunk* chunk = shards[s].head.load(std::memory_order_acquire);
+        while (chunk != nullptr) {
+            Chunk* next = chunk->next.load(std::memory_order_acquire);
+            int count = next != nullptr ? chunkSize : chunk->count.load(std::memory_order_acquire);
+            for (int i = 0; i < count; i++)
+                visit(chunk->items[i], chunk->tickets != nullptr ? chunk->tickets[i] : 0);
+            chunk = next;
+        }
+    }
+}
+
+// Walks the chunks rather than keeping a shared counter, which every Append
+// would have to bump.
+template <class T>
+int ConcurrentAppendSequence<T>::GetLength() const {
+    int length = 0;
+    for (int s = 0; s < shardCount; s++) {
+        Chunk* chunk = shards[s].head.load(std::memory_order_acquire);
+        while (chunk != nullptr) {
+            Chunk* next = chunk->next.load(std::memory_order_acquire);
+            length += next != nullptr ? chunkSize : chunk->count.load(std::memory_order_acquire);
+            chunk = next;
+        }
+    }
+    return length;
+}
+
+template <class T>
+MutableArraySequence<T> ConcurrentAppendSequence<T>::Snapshot() const {
+    MutableArraySequence<T> result;
+
+    if (ordering == Ordering::UNORDERED) {
+        result.Reserve(GetLength());
+        ForEachPublished([&result](const T& item, long long) { result.Append(item); });
+        return result;
+    }
+
+    // Tickets below the counter are all drawn; the ones not yet published
+    // leave holes, and the snapshot stops at the first.
+    int issued = static_cast<int>(nextTicket.load(std::memory_order_acquire));
+    DynamicArray<const T*> byTicket(issued);
+    for (int i = 0; i < issued; i++) byTicket[i] = nullptr;
+    ForEachPublished([&byTicket, issued](const T& item, long long ticket) {
+        if (ticket < issued) byTicket[static_cast<int>(ticket)] = &item;
+    });
+
+    result.Reserve(issued);
+    for (int i = 0; i < issued && byTicket[i] != nullptr; i++) result.Append(*byTicket[i]);
+    return result;
+}
\ No newline at end of file
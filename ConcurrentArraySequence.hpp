@@ -0,0 +1,488 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+#include "error.hpp"
+#include "Result.hpp"
+#include "ArraySequence.hpp"
+
+// An array sequence for read-mostly sharing between threads. Writers take one
+// mutex; readers take nothing. Every write that moves or overwrites visible
+// items runs between two increments of a sequence counter, and a read copies
+// what it needs, then retries if the counter moved (a seqlock). Appends into
+// spare capacity touch no visible item and skip the counter. A read that
+// keeps losing to writers falls back to the writer mutex after a few tries.
+//
+// Growing publishes a new buffer; a reader may still be copying from the old
+// one. Mode::SEQLOCK keeps old buffers until the sequence is destroyed (with
+// doubling they add up to less than the final capacity) and reads are plain
+// loads. Mode::RCU frees an old buffer once every read that could see it has
+// finished: readers announce themselves in per-thread counters split by
+// epoch parity, and the writer flips the epoch twice and waits for each side
+// to drain, as in sleepable RCU.
+//
+// Buffers hold items as machine words that readers and writers access only
+// through relaxed atomics, so a read racing a write is well defined; the
+// sequence check throws a torn copy away, and a T is rebuilt from the words
+// (by memcpy) only after the check passed. T must therefore be trivially
+// copyable.
+
+template <class T>
+class ConcurrentArraySequence {
+    static_assert(std::is_trivially_copyable_v<T>, "optimistic reads copy items as raw words");
+
+public:
+    enum class Mode { SEQLOCK = 1, RCU };
+
+private:
+    // The widest word that divides the item size.
+    using Word = std::conditional_t<sizeof(T) % 8 == 0, std::uint64_t,
+        std::conditional_t<sizeof(T) % 4 == 0, std::uint32_t,
+        std::conditional_t<sizeof(T) % 2 == 0, std::uint16_t, std::uint8_t>>>;
+    static constexpr std::size_t ItemWords = sizeof(T) / sizeof(Word);
+    static_assert(std::atomic<Word>::is_always_lock_free);
+
+    struct Buffer {
+        int capacity;
+        std::atomic<Word>* words;
+        // Older buffers kept alive in SEQLOCK mode.
+        Buffer* retired;
+    };
+
+    // An item's words copied out of a buffer.
+    struct ItemWordsCopy {
+        Word words[ItemWords];
+
+        T Build() const {
+            T item;
+            std::memcpy(static_cast<void*>(&item), words, sizeof(T));
+            return item;
+        }
+    };
+
+    struct alignas(64) ReaderSlot {
+        std::atomic<long> active[2] = { 0, 0 };
+    };
+
+    static constexpr int ReaderSlots = 64;
+    static constexpr int OptimisticAttempts = 16;
+
+    Mode mode;
+    alignas(64) std::atomic<unsigned> sequence;
+    std::atomic<int> length;
+    std::atomic<Buffer*> current;
+    alignas(64) std::atomic<unsigned> epoch;
+    std::unique_ptr<ReaderSlot[]> readers;
+    mutable std::mutex writeMutex;
+
+    class ReadSection;
+
+    static int ThreadOrdinal();
+    static Buffer* NewBuffer(int capacity);
+    static void FreeBuffer(Buffer* buffer) noexcept;
+    static void LoadItems(const Buffer* buffer, int first, int count, Word* target);
+    static void StoreItems(Buffer* buffer, int first, const T* items, int count);
+    static void MoveItems(Buffer* buffer, int to, int from, int count);
+
+    void Grow(int minimum);
+    void Synchronize();
+    void BeginWrite();
+    void EndWrite();
+
+    // body(buffer, size) on a consistent view; its result is returned.
+    template <class F>
+    auto Read(F body) const;
+    // The item at pick(size), or missing if pick returns -1.
+    template <class Pick>
+    Result<T> TryLoad(Pick pick, ErrorCode missing) const;
+    // Items [first, first + count) into words, or false if they do not exist.
+    bool LoadRange(int first, int count, DynamicArray<Word>& words) const;
+
+public:
+    explicit ConcurrentArraySequence(Mode mode = Mode::SEQLOCK, int capacity = 16);
+    ConcurrentArraySequence(const T* items, int count, Mode mode = Mode::SEQLOCK);
+    ConcurrentArraySequence(const ConcurrentArraySequence<T>&) = delete;
+    ConcurrentArraySequence<T>& operator=(const ConcurrentArraySequence<T>&) = delete;
+    ~ConcurrentArraySequence();
+
+    Mode GetMode() const { return mode; }
+
+    T GetFirst() const;
+    T GetLast() const;
+    T Get(int index) const;
+    Result<T> TryGetFirst() const;
+    Result<T> TryGetLast() const;
+    Result<T> TryGet(int index) const;
+    int GetLength() const { return length.load(std::memory_order_acquire); }
+    MutableArraySequence<T> GetSubsequence(int startIndex, int endIndex) const;
+    MutableArraySequence<T> Snapshot() const;
+
+    void Append(const T& item);
+    void Prepend(const T& item);
+    void InsertAt(const T& item, int index);
+    void Set(int index, const T& item);
+    void Remove(int index);
+    // Replaces the whole contents in one step.
+    void Assign(const T* items, int count);
+    // New items are value-initialized.
+    void Resize(int newSize);
+    void Reserve(int capacity);
+    void Clear();
+};
+
+template <class T>
+class ConcurrentArraySequence<T>::ReadSection {
+private:
+    ReaderSlot* slot;
+    unsigned side;
+
+public:
+    explicit ReadSection(const ConcurrentArraySequence<T>& seq) : slot(nullptr), side(0) {
+        if (seq.mode != Mode::RCU) return;
+        slot = &seq.readers[ThreadOrdinal() % ReaderSlots];
+        side = seq.epoch.load() & 1;
+        slot->active[side].fetch_add(1);
+    }
+    ReadSection(const ReadSection&) = delete;
+    ReadSection& operator=(const ReadSection&) = delete;
+    ~ReadSection() {
+        if (slot != nullptr) slot->active[side].fetch_sub(1, std::memory_order_release);
+    }
+};
+
+template <class T>
+int ConcurrentArraySequence<T>::ThreadOrdinal() {
+    static std::atomic<int> threads{ 0 };
+    thread_local int ordinal = threads.fetch_add(1, std::memory_order_relaxed);
+    return ordinal;
+}
+
+template <class T>
+typename ConcurrentArraySequence<T>::Buffer* ConcurrentArraySequence<T>::NewBuffer(int capacity) {
+    std::unique_ptr<Buffer> buffer(new Buffer{ capacity, nullptr, nullptr });
+    buffer->words = new std::atomic<Word>[std::size_t(capacity) * ItemWords];
+    return buffer.release();
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::FreeBuffer(Buffer* buffer) noexcept {
+    delete[] buffer->words;
+    delete buffer;
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::LoadItems(const Buffer* buffer, int first, int count, Word* target) {
+    const std::atomic<Word>* source = buffer->words + std::size_t(first) * ItemWords;
+    std::size_t words = std::size_t(count) * ItemWords;
+    for (std::size_t i = 0; i < words; i++) target[i] = source[i].load(std::memory_order_relaxed);
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::StoreItems(Buffer* buffer, int first, const T* items, int count) {
+    std::atomic<Word>* target = buffer->words + std::size_t(first) * ItemWords;
+    for (int i = 0; i < count; i++) {
+        Word words[ItemWords];
+        std::memcpy(words, static_cast<const void*>(items + i), sizeof(T));
+        for (std::size_t w = 0; w < ItemWords; w++) target[w].store(words[w], std::memory_order_relaxed);
+        target += ItemWords;
+    }
+}
+
+// Overlapping ranges are fine, as with memmove.
+template <class T>
+void ConcurrentArraySequence<T>::MoveItems(Buffer* buffer, int to, int from, int count) {
+    std::atomic<Word>* words = buffer->words;
+    std::size_t target = std::size_t(to) * ItemWords, source = std::size_t(from) * ItemWords;
+    std::size_t total = std::size_t(count) * ItemWords;
+    if (to < from) {
+        for (std::size_t i = 0; i < total; i++)
+            words[target + i].store(words[source + i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    else {
+        for (std::size_t i = total; i > 0; i--)
+            words[target + i - 1].store(words[source + i - 1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+template <class T>
+ConcurrentArraySequence<T>::ConcurrentArraySequence(Mode mode, int capacity)
+    : mode(mode), sequence(0), length(0), current(nullptr), epoch(0), readers(new ReaderSlot[ReaderSlots]) {
+    if (capacity < 0) throw Errors::NegativeSize();
+    current.store(NewBuffer(capacity > 0 ? capacity : 1), std::memory_order_relaxed);
+}
+
+template <class T>
+ConcurrentArraySequence<T>::ConcurrentArraySequence(const T* items, int count, Mode mode)
+    : ConcurrentArraySequence(mode, count) {
+    StoreItems(current.load(std::memory_order_relaxed), 0, items, count);
+    length.store(count, std::memory_order_relaxed);
+}
+
+template <class T>
+ConcurrentArraySequence<T>::~ConcurrentArraySequence() {
+    Buffer* buffer = current.load(std::memory_order_relaxed);
+    while (buffer != nullptr) {
+        Buffer* older = buffer->retired;
+        FreeBuffer(buffer);
+        buffer = older;
+    }
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::BeginWrite() {
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::EndWrite() {
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+// Readers that started on one epoch side are drained after the flip away
+// from it; two flips cover a reader that read the epoch just before the
+// first one.
+template <class T>
+void ConcurrentArraySequence<T>::Synchronize() {
+    for (int round = 0; round < 2; round++) {
+        unsigned side = epoch.fetch_add(1) & 1;
+        for (int s = 0; s < ReaderSlots; s++)
+            while (readers[s].active[side].load() != 0) std::this_thread::yield();
+    }
+}
+
+// Called with the writer mutex held. The new buffer is published before
+// the length can pass the old capacity, so a reader that loads the length
+// and then the buffer never indexes past the end.
+template <class T>
+void ConcurrentArraySequence<T>::Grow(int minimum) {
+    Buffer* old = current.load(std::memory_order_relaxed);
+    if (minimum <= old->capacity) return;
+
+    int capacity = old->capacity * 2 > minimum ? old->capacity * 2 : minimum;
+    Buffer* fresh = NewBuffer(capacity);
+    std::size_t words = std::size_t(length.load(std::memory_order_relaxed)) * ItemWords;
+    for (std::size_t i = 0; i < words; i++)
+        fresh->words[i].store(old->words[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    current.store(fresh, std::memory_order_release);
+
+    if (mode == Mode::RCU) {
+        Synchronize();
+        FreeBuffer(old);
+    }
+    else {
+        fresh->retired = old;
+    }
+}
+
+// The standard seqlock read: the acquire fence orders the relaxed word
+// loads before the second load of the counter.
+template <class T>
+template <class F>
+auto ConcurrentArraySequence<T>::Read(F body) const {
+    {
+        ReadSection section(*this);
+        for (int attempt = 0; attempt < OptimisticAttempts; attempt++) {
+            unsigned before = sequence.load(std::memory_order_acquire);
+            if (before & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+            int size = length.load(std::memory_order_acquire);
+            const Buffer* buffer = current.load(std::memory_order_acquire);
+            auto result = body(buffer, size);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before) return result;
+        }
+    }
+    // Outside the read section: a writer may be waiting on it.
+    std::lock_guard<std::mutex> lock(writeMutex);
+    return body(static_cast<const Buffer*>(current.load(std::memory_order_relaxed)), length.load(std::memory_order_relaxed));
+}
+
+template <class T>
+template <class Pick>
+Result<T> ConcurrentArraySequence<T>::TryLoad(Pick pick, ErrorCode missing) const {
+    ItemWordsCopy copy;
+    bool found = Read([&pick, &copy](const Buffer* buffer, int size) {
+        int index = pick(size);
+        if (index < 0) return false;
+        LoadItems(buffer, index, 1, copy.words);
+        return true;
+    });
+    if (!found) return missing;
+    return copy.Build();
+}
+
+template <class T>
+Result<T> ConcurrentArraySequence<T>::TryGet(int index) const {
+    return TryLoad([index](int size) { return index >= 0 && index < size ? index : -1; }, ErrorCode::INDEX_OUT_OF_RANGE);
+}
+
+template <class T>
+Result<T> ConcurrentArraySequence<T>::TryGetFirst() const {
+    return TryLoad([](int size) { return size > 0 ? 0 : -1; }, ErrorCode::EMPTY_ARRAY);
+}
+
+template <class T>
+Result<T> ConcurrentArraySequence<T>::TryGetLast() const {
+    return TryLoad([](int size) { return size - 1; }, ErrorCode::EMPTY_ARRAY);
+}
+
+template <class T>
+T ConcurrentArraySequence<T>::Get(int index) const {
+    Result<T> result = TryGet(index);
+    if (!result) Errors::Throw(result.Code());
+    return result.Value();
+}
+
+template <class T>
+T ConcurrentArraySequence<T>::GetFirst() const {
+    Result<T> result = TryGetFirst();
+    if (!result) Errors::Throw(result.Code());
+    return result.Value();
+}
+
+template <class T>
+T ConcurrentArraySequence<T>::GetLast() const {
+    Result<T> result = TryGetLast();
+    if (!result) Errors::Throw(result.Code());
+    return result.Value();
+}
+
+// count < 0 takes everything from first on. The scratch words are sized
+// from a racy length; a retry that finds the sequence longer grows them.
+template <class T>
+bool ConcurrentArraySequence<T>::LoadRange(int first, int count, DynamicArray<Word>& words) const {
+    int loaded = Read([first, count, &words](const Buffer* buffer, int size) {
+        int wanted = count < 0 ? size - first : count;
+        if (first + wanted > size) return -1;
+        if (std::size_t(words.GetSize()) < std::size_t(wanted) * ItemWords) words.Resize(int(std::size_t(wanted) * ItemWords));
+        LoadItems(buffer, first, wanted, words.Data());
+        return wanted;
+    });
+    if (loaded < 0) return false;
+    words.Resize(int(std::size_t(loaded) * ItemWords));
+    return true;
+}
+
+template <class T>
+MutableArraySequence<T> ConcurrentArraySequence<T>::GetSubsequence(int startIndex, int endIndex) const {
+    if (startIndex < 0 || startIndex > endIndex) throw Errors::InvalidIndices();
+
+    DynamicArray<Word> words(0);
+    if (!LoadRange(startIndex, endIndex - startIndex + 1, words)) throw Errors::InvalidIndices();
+    MutableArraySequence<T> result(endIndex - startIndex + 1);
+    std::memcpy(static_cast<void*>(result.Data()), words.Data(), sizeof(Word) * std::size_t(words.GetSize()));
+    return result;
+}
+
+template <class T>
+MutableArraySequence<T> ConcurrentArraySequence<T>::Snapshot() const {
+    DynamicArray<Word> words(int(std::size_t(GetLength()) * ItemWords));
+    LoadRange(0, -1, words);
+    MutableArraySequence<T> result(int(words.GetSize() / int(ItemWords)));
+    std::memcpy(static_cast<void*>(result.Data()), words.Data(), sizeof(Word) * std::size_t(words.GetSize()));
+    return result;
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::Append(const T& item) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    int size = length.load(std::memory_order_relaxed);
+    Grow(size + 1);
+    StoreItems(current.load(std::memory_order_relaxed), size, &item, 1);
+    length.store(size + 1, std::memory_order_release);
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::Prepend(const T& item) {
+    InsertAt(item, 0);
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::InsertAt(const T& item, int index) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    int size = length.load(std::memory_order_relaxed);
+    if (index < 0 || index > size) throw Errors::IndexOutOfRange();
+    Grow(size + 1);
+
+    Buffer* buffer = current.load(std::memory_order_relaxed);
+    BeginWrite();
+    MoveItems(buffer, index + 1, index, size - index);
+    StoreItems(buffer, index, &item, 1);
+    length.store(size + 1, std::memory_order_relaxed);
+    EndWrite();
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::Set(int index, const T& item) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    if (index < 0 || index >= length.load(std::memory_order_relaxed)) throw Errors::IndexOutOfRange();
+
+    BeginWrite();
+    StoreItems(current.load(std::memory_order_relaxed), index, &item, 1);
+    EndWrite();
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::Remove(int index) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    int size = length.load(std::memory_order_relaxed);
+    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
+
+    BeginWrite();
+    MoveItems(current.load(std::memory_order_relaxed), index, index + 1, size - index - 1);
+    length.store(size - 1, std::memory_order_relaxed);
+    EndWrite();
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::Assign(const T* items, int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    std::lock_guard<std::mutex> lock(writeMutex);
+    Grow(count);
+
+    BeginWrite();
+    StoreItems(current.load(std::memory_order_relaxed), 0, items, count);
+    length.store(count, std::memory_order_relaxed);
+    EndWrite();
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::Resize(int newSize) {
+    if (newSize < 0) throw Errors::NegativeSize();
+    std::lock_guard<std::mutex> lock(writeMutex);
+    int size = length.load(std::memory_order_relaxed);
+
+    if (newSize <= size) {
+        BeginWrite();
+        length.store(newSize, std::memory_order_relaxed);
+        EndWrite();
+        return;
+    }
+
+    Grow(newSize);
+    Buffer* buffer = current.load(std::memory_order_relaxed);
+    T blank{};
+    for (int i = size; i < newSize; i++) StoreItems(buffer, i, &blank, 1);
+    length.store(newSize, std::memory_order_release);
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::Reserve(int capacity) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    Grow(capacity);
+}
+
+template <class T>
+void ConcurrentArraySequence<T>::Clear() {
+    Resize(0);
+}
\ No newline at end of file
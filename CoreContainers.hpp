@@ -0,0 +1,193 @@
+#pragma once
+
+#include "StaticSequence.hpp"
+#include "Result.hpp"
+#include "error.hpp"
+
+// Non-virtual stack, queue and deque over ArrayCore/ListCore. They offer the
+// same operations as Stack<T>, Queue<T> and Deque<T>, resolved at compile time.
+
+template <class Core>
+class CoreStack : public Core {
+public:
+    using T = typename Core::value_type;
+
+    void Push(const T& item);
+    T Pop();
+    const T& Top() const;
+    Result<T> TryPop();
+    Result<T> TryTop() const;
+};
+
+template <class Core>
+void CoreStack<Core>::Push(const T& item) {
+    this->Append(item);
+}
+
+template <class Core>
+typename Core::value_type CoreStack<Core>::Pop() {
+    if (this->IsEmpty()) throw Errors::EmptyStackError();
+    T item = this->GetLast();
+    this->Remove(this->GetLength() - 1);
+    return item;
+}
+
+template <class Core>
+const typename Core::value_type& CoreStack<Core>::Top() const {
+    if (this->IsEmpty()) throw Errors::EmptyStackError();
+    return this->At(this->GetLength() - 1);
+}
+
+template <class Core>
+Result<typename Core::value_type> CoreStack<Core>::TryPop() {
+    if (this->IsEmpty()) return ErrorCode::EMPTY_STACK;
+    T item = this->GetLast();
+    this->Remove(this->GetLength() - 1);
+    return item;
+}
+
+template <class Core>
+Result<typename Core::value_type> CoreStack<Core>::TryTop() const {
+    if (this->IsEmpty()) return ErrorCode::EMPTY_STACK;
+    return this->GetLast();
+}
+
+
+template <class Core>
+class CoreQueue : public Core {
+public:
+    using T = typename Core::value_type;
+
+    void Enqueue(const T& item);
+    T Dequeue();
+    const T& Peek() const;
+    const T& Front() const;
+    const T& Back() const;
+    Result<T> TryDequeue();
+    Result<T> TryPeek() const;
+};
+
+template <class Core>
+void CoreQueue<Core>::Enqueue(const T& item) {
+    this->Append(item);
+}
+
+template <class Core>
+typename Core::value_type CoreQueue<Core>::Dequeue() {
+    if (this->IsEmpty()) Errors::Throw(Core::EmptyCode);
+    T value = this->GetFirst();
+    this->Remove(0);
+    return value;
+}
+
+template <class Core>
+const typename Core::value_type& CoreQueue<Core>::Peek() const {
+    return Front();
+}
+
+template <class Core>
+const typename Core::value_type& CoreQueue<Core>::Front() const {
+    if (this->IsEmpty()) Errors::Throw(Core::EmptyCode);
+    return this->At(0);
+}
+
+template <class Core>
+const typename Core::value_type& CoreQueue<Core>::Back() const {
+    if (this->IsEmpty()) Errors::Throw(Core::EmptyCode);
+    return this->At(this->GetLength() - 1);
+}
+
+template <class Core>
+Result<typename Core::value_type> CoreQueue<Core>::TryDequeue() {
+    if (this->IsEmpty()) return Core::EmptyCode;
+    T value = this->GetFirst();
+    this->Remove(0);
+    return value;
+}
+
+template <class Core>
+Result<typename Core::value_type> CoreQueue<Core>::TryPeek() const {
+    return this->TryGetFirst();
+}
+
+
+template <class Core>
+class CoreDeque : public Core {
+public:
+    using T = typename Core::value_type;
+
+    void PushFront(const T& item);
+    void PushBack(const T& item);
+    T PopFront();
+    T PopBack();
+    const T& Front() const;
+    const T& Back() const;
+    Result<T> TryPopFront();
+    Result<T> TryPopBack();
+    Result<T> TryFront() const;
+    Result<T> TryBack() const;
+};
+
+template <class Core>
+void CoreDeque<Core>::PushFront(const T& item) {
+    this->Prepend(item);
+}
+
+template <class Core>
+void CoreDeque<Core>::PushBack(const T& item) {
+    this->Append(item);
+}
+
+template <class Core>
+typename Core::value_type CoreDeque<Core>::PopFront() {
+    if (this->IsEmpty()) Errors::Throw(Core::EmptyCode);
+    T val = this->GetFirst();
+    this->Remove(0);
+    return val;
+}
+
+template <class Core>
+typename Core::value_type CoreDeque<Core>::PopBack() {
+    if (this->IsEmpty()) Errors::Throw(Core::EmptyCode);
+    T val = this->GetLast();
+    this->Remove(this->GetLength() - 1);
+    return val;
+}
+
+template <class Core>
+const typename Core::value_type& CoreDeque<Core>::Front() const {
+    if (this->IsEmpty()) Errors::Throw(Core::EmptyCode);
+    return this->At(0);
+}
+
+template <class Core>
+const typename Core::value_type& CoreDeque<Core>::Back() const {
+    if (this->IsEmpty()) Errors::Throw(Core::EmptyCode);
+    return this->At(this->GetLength() - 1);
+}
+
+template <class Core>
+Result<typename Core::value_type> CoreDeque<Core>::TryPopFront() {
+    if (this->IsEmpty()) return Core::EmptyCode;
+    T val = this->GetFirst();
+    this->Remove(0);
+    return val;
+}
+
+template <class Core>
+Result<typename Core::value_type> CoreDeque<Core>::TryPopBack() {
+    if (this->IsEmpty()) return Core::EmptyCode;
+    T val = this->GetLast();
+    this->Remove(this->GetLength() - 1);
+    return val;
+}
+
+template <class Core>
+Result<typename Core::value_type> CoreDeque<Core>::TryFront() const {
+    return this->TryGetFirst();
+}
+
+template <class Core>
+Result<typename Core::value_type> CoreDeque<Core>::TryBack() const {
+    return this->TryGetLast();
+}
\ No newline at end of file
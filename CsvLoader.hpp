@@ -0,0 +1,302 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "error.hpp"
+#include "User.hpp"
+
+// Bulk, non-interactive loading of User/Student/Professor records from CSV
+// or TSV text. Csv::Load maps the file read-only and Csv::Parse splits it in
+// place: fields are string_views into the mapping (quoted fields with ""
+// escapes are unescaped into a scratch buffer), integers go through
+// std::from_chars, and only the record strings themselves are allocated.
+// Sequences with Reserve() get one reservation sized by a newline count
+// before parsing; lists and other containers are filled with Append.
+//
+// Columns: name,age,id for User, then group,exam_pass for Student and
+// subject,be_on_exam for Professor. Booleans are 1/0, true/false or yes/no.
+// A malformed row throws InvalidArgument naming its line.
+
+namespace Csv {
+
+    struct Options {
+        char delimiter = ',';
+        bool hasHeader = true;
+    };
+
+    class MappedFile {
+    private:
+        void* mapping;
+        std::size_t size;
+
+    public:
+        explicit MappedFile(const std::string& path);
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+
+        std::string_view Text() const { return { static_cast<const char*>(mapping), size }; }
+    };
+
+    class Row {
+    public:
+        static constexpr int MaxFields = 16;
+
+    private:
+        std::string_view fields[MaxFields];
+        int count = 0;
+        int line = 0;
+
+        friend class Reader;
+
+        [[noreturn]] void Fail(const char* problem, int index) const;
+
+    public:
+        int GetCount() const { return count; }
+        int GetLine() const { return line; }
+        std::string_view Field(int index) const { return fields[index]; }
+
+        void RequireColumns(int columns) const;
+        std::string String(int index) const { return std::string(fields[index]); }
+        int Int(int index) const;
+        bool Bool(int index) const;
+    };
+
+    class Reader {
+    private:
+        const char* current;
+        const char* end;
+        char delimiter;
+        int line;
+        std::string scratch[Row::MaxFields];
+
+        [[noreturn]] void Fail(const char* problem) const;
+        const char* ReadQuoted(const char* p, const char*& lineEnd, Row& row);
+
+    public:
+        Reader(std::string_view text, char delimiter) : current(text.data()), end(text.data() + text.size()), delimiter(delimiter), line(0) {}
+
+        // Fills row with the next non-empty row; false at the end of the text.
+        bool Next(Row& row);
+    };
+
+    template <class Record>
+    struct RecordParser;
+
+    template <>
+    struct RecordParser<User> {
+        static User Parse(const Row& row) {
+            row.RequireColumns(3);
+            return User(row.String(0), row.Int(1), row.Int(2));
+        }
+    };
+
+    template <>
+    struct RecordParser<Student> {
+        static Student Parse(const Row& row) {
+            row.RequireColumns(5);
+            return Student(row.String(0), row.Int(1), row.Int(2), row.String(3), row.Bool(4));
+        }
+    };
+
+    template <>
+    struct RecordParser<Professor> {
+        static Professor Parse(const Row& row) {
+            row.RequireColumns(5);
+            return Professor(row.String(0), row.Int(1), row.Int(2), row.String(3), row.Bool(4));
+        }
+    };
+
+
+    inline MappedFile::MappedFile(const std::string& path) : mapping(nullptr), size(0) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw Errors::IoError("cannot open " + path + ": " + std::strerror(errno));
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw Errors::IoError("cannot stat " + path + ": " + std::strerror(errno));
+        }
+        size = std::size_t(info.st_size);
+        if (size != 0) {
+            mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                mapping = nullptr;
+                ::close(fd);
+                throw Errors::IoError("cannot map " + path + ": " + std::strerror(errno));
+            }
+            ::madvise(mapping, size, MADV_SEQUENTIAL);
+        }
+        ::close(fd);
+    }
+
+    inline MappedFile::~MappedFile() {
+        if (mapping != nullptr) ::munmap(mapping, size);
+    }
+
+    inline void Row::Fail(const char* problem, int index) const {
+        std::string message = "line " + std::to_string(line) + ", column " + std::to_string(index + 1) + ": " + problem;
+        throw Errors::InvalidArgument(message);
+    }
+
+    inline void Row::RequireColumns(int columns) const {
+        if (count != columns) {
+            std::string message = "line " + std::to_string(line) + ": expected " + std::to_string(columns) +
+                " fields, got " + std::to_string(count);
+            throw Errors::InvalidArgument(message);
+        }
+    }
+
+    inline int Row::Int(int index) const {
+        std::string_view field = fields[index];
+        int value = 0;
+        auto [last, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+        if (error != std::errc() || last != field.data() + field.size() || field.empty()) Fail("expected an integer", index);
+        return value;
+    }
+
+    inline bool Row::Bool(int index) const {
+        std::string_view field = fields[index];
+        if (field == "1" || field == "true" || field == "yes") return true;
+        if (field == "0" || field == "false" || field == "no") return false;
+        Fail("expected a boolean", index);
+    }
+
+    inline void Reader::Fail(const char* problem) const {
+        throw Errors::InvalidArgument("line " + std::to_string(line) + ": " + problem);
+    }
+
+    // p is just past the opening quote. Returns the position after the
+    // closing quote; a quoted field may run over line ends.
+    inline const char* Reader::ReadQuoted(const char* p, const char*& lineEnd, Row& row) {
+        const char* start = p;
+        bool escaped = false;
+        for (;;) {
+            auto quote = static_cast<const char*>(std::memchr(p, '"', std::size_t(end - p)));
+            if (quote == nullptr) Fail("unterminated quoted field");
+            if (quote + 1 < end && quote[1] == '"') {
+                escaped = true;
+                p = quote + 2;
+                continue;
+            }
+            p = quote;
+            break;
+        }
+
+        if (p > lineEnd) {
+            line += int(std::count(start, p, '\n'));
+            auto next = static_cast<const char*>(std::memchr(p, '\n', std::size_t(end - p)));
+            lineEnd = next ? next : end;
+        }
+
+        std::string_view field(start, std::size_t(p - start));
+        if (escaped) {
+            std::string& text = scratch[row.count];
+            text.clear();
+            for (std::size_t i = 0; i < field.size(); i++) {
+                text += field[i];
+                if (field[i] == '"') i++;
+            }
+            field = text;
+        }
+        row.fields[row.count++] = field;
+        return p + 1;
+    }
+
+    inline bool Reader::Next(Row& row) {
+        while (current < end) {
+            line++;
+            const char* p = current;
+            auto next = static_cast<const char*>(std::memchr(p, '\n', std::size_t(end - p)));
+            const char* lineEnd = next ? next : end;
+            if (p == lineEnd || (*p == '\r' && p + 1 == lineEnd)) {
+                current = lineEnd < end ? lineEnd + 1 : end;
+                continue;
+            }
+
+            row.count = 0;
+            row.line = line;
+            for (;;) {
+                if (row.count == Row::MaxFields) Fail("too many fields");
+
+                if (p < lineEnd && *p == '"') {
+                    p = ReadQuoted(p + 1, lineEnd, row);
+                    if (p < lineEnd && *p == '\r' && p + 1 == lineEnd) p++;
+                    if (p < lineEnd && *p != delimiter) Fail("text after a closing quote");
+                }
+                else {
+                    auto stop = static_cast<const char*>(std::memchr(p, delimiter, std::size_t(lineEnd - p)));
+                    if (stop == nullptr) stop = lineEnd;
+                    std::string_view field(p, std::size_t(stop - p));
+                    if (stop == lineEnd && !field.empty() && field.back() == '\r') field.remove_suffix(1);
+                    row.fields[row.count++] = field;
+                    p = stop;
+                }
+
+                if (p == lineEnd) break;
+                p++;
+            }
+
+            current = lineEnd < end ? lineEnd + 1 : end;
+            return true;
+        }
+        return false;
+    }
+
+
+    // Upper bound on the number of rows; quoted line breaks only make it larger.
+    inline int CountLines(std::string_view text) {
+        int lines = 0;
+        const char* p = text.data();
+        const char* end = p + text.size();
+        while (p < end) {
+            auto next = static_cast<const char*>(std::memchr(p, '\n', std::size_t(end - p)));
+            lines++;
+            if (next == nullptr) break;
+            p = next + 1;
+        }
+        return lines;
+    }
+
+    template <class C, class = void>
+    struct HasReserve : std::false_type {};
+    template <class C>
+    struct HasReserve<C, std::void_t<decltype(std::declval<C&>().Reserve(0))>> : std::true_type {};
+
+    // Appends the records in text to container and returns how many there were.
+    template <class Container>
+    int Parse(std::string_view text, Container& container, Options options = {}) {
+        using Record = std::decay_t<decltype(container.Get(0))>;
+
+        if constexpr (HasReserve<Container>::value)
+            container.Reserve(container.GetLength() + CountLines(text));
+
+        Reader reader(text, options.delimiter);
+        Row row;
+        if (options.hasHeader) reader.Next(row);
+
+        int loaded = 0;
+        while (reader.Next(row)) {
+            container.Append(RecordParser<Record>::Parse(row));
+            loaded++;
+        }
+        return loaded;
+    }
+
+    template <class Container>
+    int Load(const std::string& path, Container& container, Options options = {}) {
+        MappedFile file(path);
+        return Parse(file.Text(), container, options);
+    }
+}
\ No newline at end of file
@@ -1,195 +1,271 @@
-#pragma once
-
-#include "ArraySequence.hpp"
-#include "ListSequence.hpp"
-#include "error.hpp"
-
-template <class T>
-class Deque {
-public:
-    virtual ~Deque() = default;
-
-    virtual void PushFront(const T& item) = 0;
-    virtual void PushBack(const T& item) = 0;
-    virtual T PopFront() = 0;
-    virtual T PopBack() = 0;
-    virtual T Front() const = 0;
-    virtual T Back() const = 0;
-
-    virtual T Get(int index) const = 0;
-    virtual int GetLength() const = 0;
-    virtual bool IsEmpty() const = 0;
-};
-
-
-
-
-template <class T>
-class ArrayDeque : public MutableArraySequence<T>, public Deque<T> {
-public:
-    ArrayDeque();
-    ArrayDeque(T* items, int count);
-    ArrayDeque(const ArrayDeque<T>& other);
-    ~ArrayDeque() override;
-
-    void PushFront(const T& item) override;
-    void PushBack(const T& item) override;
-    T PopFront() override;
-    T PopBack() override;
-    T Front() const override;
-    T Back() const override;
-
-    T Get(int index) const override;
-    int GetLength() const override;
-    bool IsEmpty() const override;
-};
-
-template <typename T>
-ArrayDeque<T>::ArrayDeque() : MutableArraySequence<T>() {}
-
-template <typename T>
-ArrayDeque<T>::ArrayDeque(T* items, int count) : MutableArraySequence<T>(items, count) {}
-
-template <typename T>
-ArrayDeque<T>::ArrayDeque(const ArrayDeque<T>& other) : MutableArraySequence<T>(other) {}
-
-template <typename T>
-ArrayDeque<T>::~ArrayDeque() = default;
-
-template <typename T>
-void ArrayDeque<T>::PushFront(const T& item) {
-    this->Prepend(item);
-}
-
-template <typename T>
-void ArrayDeque<T>::PushBack(const T& item) {
-    this->Append(item);
-}
-
-template <typename T>
-T ArrayDeque<T>::PopFront() {
-    if (this->IsEmpty()) throw Errors::EmptyArray();
-    T val = this->GetFirst();
-    this->Remove(0);
-    return val;
-}
-
-template <typename T>
-T ArrayDeque<T>::PopBack() {
-    if (this->IsEmpty()) throw Errors::EmptyArray();
-    T val = this->GetLast();
-    this->size--;
-    return val;
-}
-
-template <typename T>
-T ArrayDeque<T>::Front() const {
-    return this->GetFirst();
-}
-
-template <typename T>
-T ArrayDeque<T>::Back() const {
-    return this->GetLast();
-}
-
-template <typename T>
-T ArrayDeque<T>::Get(int index) const {
-    return this->MutableArraySequence<T>::Get(index);
-}
-
-template <typename T>
-int ArrayDeque<T>::GetLength() const {
-    return this->MutableArraySequence<T>::GetLength();
-}
-
-template <typename T>
-bool ArrayDeque<T>::IsEmpty() const {
-    return this->GetLength() == 0;
-}
-
-
-
-
-
-template <class T>
-class ListDeque : public MutableListSequence<T>, public Deque<T> {
-public:
-    ListDeque();
-    ListDeque(T* items, int count);
-    ListDeque(const ListDeque<T>& other);
-    ~ListDeque() override;
-
-    void PushFront(const T& item) override;
-    void PushBack(const T& item) override;
-    T PopFront() override;
-    T PopBack() override;
-    T Front() const override;
-    T Back() const override;
-
-    T Get(int index) const override;
-    int GetLength() const override;
-    bool IsEmpty() const override;
-};
-
-template <typename T>
-ListDeque<T>::ListDeque() : MutableListSequence<T>() {}
-
-template <typename T>
-ListDeque<T>::ListDeque(T* items, int count) : MutableListSequence<T>(items, count) {}
-
-template <typename T>
-ListDeque<T>::ListDeque(const ListDeque<T>& other) : MutableListSequence<T>(other) {}
-
-template <typename T>
-ListDeque<T>::~ListDeque() = default;
-
-template <typename T>
-void ListDeque<T>::PushFront(const T& item) {
-    this->Prepend(item);
-}
-
-template <typename T>
-void ListDeque<T>::PushBack(const T& item) {
-    this->Append(item);
-}
-
-template <typename T>
-T ListDeque<T>::PopFront() {
-    if (this->IsEmpty()) throw Errors::EmptyList();
-    T val = this->GetFirst();
-    this->Remove(0);
-    return val;
-}
-
-template <typename T>
-T ListDeque<T>::PopBack() {
-    if (this->IsEmpty()) throw Errors::EmptyList();
-    T val = this->GetLast();
-    this->size--;
-    return val;
-}
-
-template <typename T>
-T ListDeque<T>::Front() const {
-    return this->GetFirst();
-}
-
-template <typename T>
-T ListDeque<T>::Back() const {
-    return this->GetLast();
-}
-
-template <typename T>
-T ListDeque<T>::Get(int index) const {
-    return this->MutableListSequence<T>::Get(index);
-}
-
-template <typename T>
-int ListDeque<T>::GetLength() const {
-    return this->MutableListSequence<T>::GetLength();
-}
-
-template <typename T>
-bool ListDeque<T>::IsEmpty() const {
-    return this->GetLength() == 0;
+#pragma once
+
+#include "ArraySequence.hpp"
+#include "ListSequence.hpp"
+#include "error.hpp"
+
+template <class T>
+class Deque {
+public:
+    virtual ~Deque() = default;
+
+    virtual void PushFront(const T& item) = 0;
+    virtual void PushBack(const T& item) = 0;
+    virtual T PopFront() = 0;
+    virtual T PopBack() = 0;
+    virtual const T& Front() const = 0;
+    virtual const T& Back() const = 0;
+    virtual Result<T> TryPopFront() = 0;
+    virtual Result<T> TryPopBack() = 0;
+    virtual Result<T> TryFront() const = 0;
+    virtual Result<T> TryBack() const = 0;
+
+    virtual T Get(int index) const = 0;
+    virtual int GetLength() const = 0;
+    virtual bool IsEmpty() const = 0;
+};
+
+
+
+
+template <class T>
+class ArrayDeque : public MutableArraySequence<T>, public Deque<T> {
+public:
+    ArrayDeque();
+    explicit ArrayDeque(std::pmr::memory_resource* resource);
+    ArrayDeque(T* items, int count, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    ArrayDeque(const ArrayDeque<T>& other);
+    ~ArrayDeque() override;
+
+    void PushFront(const T& item) override;
+    void PushBack(const T& item) override;
+    T PopFront() override;
+    T PopBack() override;
+    const T& Front() const override;
+    const T& Back() const override;
+    Result<T> TryPopFront() override;
+    Result<T> TryPopBack() override;
+    Result<T> TryFront() const override;
+    Result<T> TryBack() const override;
+
+    T Get(int index) const override;
+    int GetLength() const override;
+    bool IsEmpty() const override;
+};
+
+template <typename T>
+ArrayDeque<T>::ArrayDeque() : MutableArraySequence<T>() {}
+
+template <typename T>
+ArrayDeque<T>::ArrayDeque(std::pmr::memory_resource* resource) : MutableArraySequence<T>(resource) {}
+
+template <typename T>
+ArrayDeque<T>::ArrayDeque(T* items, int count, std::pmr::memory_resource* resource) : MutableArraySequence<T>(items, count, resource) {}
+
+template <typename T>
+ArrayDeque<T>::ArrayDeque(const ArrayDeque<T>& other) : MutableArraySequence<T>(other) {}
+
+template <typename T>
+ArrayDeque<T>::~ArrayDeque() = default;
+
+template <typename T>
+void ArrayDeque<T>::PushFront(const T& item) {
+    this->Prepend(item);
+}
+
+template <typename T>
+void ArrayDeque<T>::PushBack(const T& item) {
+    this->Append(item);
+}
+
+template <typename T>
+T ArrayDeque<T>::PopFront() {
+    if (this->IsEmpty()) throw Errors::EmptyArray();
+    T val = this->GetFirst();
+    this->Remove(0);
+    return val;
+}
+
+template <typename T>
+T ArrayDeque<T>::PopBack() {
+    if (this->IsEmpty()) throw Errors::EmptyArray();
+    T val = this->GetLast();
+    this->size--;
+    return val;
+}
+
+template <typename T>
+const T& ArrayDeque<T>::Front() const {
+    if (this->IsEmpty()) throw Errors::EmptyArray();
+    return this->At(0);
+}
+
+template <typename T>
+const T& ArrayDeque<T>::Back() const {
+    if (this->IsEmpty()) throw Errors::EmptyArray();
+    return this->At(this->GetLength() - 1);
+}
+
+template <typename T>
+Result<T> ArrayDeque<T>::TryPopFront() {
+    if (this->IsEmpty()) return ErrorCode::EMPTY_ARRAY;
+    T val = this->GetFirst();
+    this->Remove(0);
+    return val;
+}
+
+template <typename T>
+Result<T> ArrayDeque<T>::TryPopBack() {
+    if (this->IsEmpty()) return ErrorCode::EMPTY_ARRAY;
+    T val = this->GetLast();
+    this->Remove(this->GetLength() - 1);
+    return val;
+}
+
+template <typename T>
+Result<T> ArrayDeque<T>::TryFront() const {
+    return this->TryGetFirst();
+}
+
+template <typename T>
+Result<T> ArrayDeque<T>::TryBack() const {
+    return this->TryGetLast();
+}
+
+template <typename T>
+T ArrayDeque<T>::Get(int index) const {
+    return this->MutableArraySequence<T>::Get(index);
+}
+
+template <typename T>
+int ArrayDeque<T>::GetLength() const {
+    return this->MutableArraySequence<T>::GetLength();
+}
+
+template <typename T>
+bool ArrayDeque<T>::IsEmpty() const {
+    return this->GetLength() == 0;
+}
+
+
+
+
+
+template <class T>
+class ListDeque : public MutableListSequence<T>, public Deque<T> {
+public:
+    ListDeque();
+    explicit ListDeque(std::pmr::memory_resource* resource);
+    ListDeque(T* items, int count, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    ListDeque(const ListDeque<T>& other);
+    ~ListDeque() override;
+
+    void PushFront(const T& item) override;
+    void PushBack(const T& item) override;
+    T PopFront() override;
+    T PopBack() override;
+    const T& Front() const override;
+    const T& Back() const override;
+    Result<T> TryPopFront() override;
+    Result<T> TryPopBack() override;
+    Result<T> TryFront() const override;
+    Result<T> TryBack() const override;
+
+    T Get(int index) const override;
+    int GetLength() const override;
+    bool IsEmpty() const override;
+};
+
+template <typename T>
+ListDeque<T>::ListDeque() : MutableListSequence<T>() {}
+
+template <typename T>
+ListDeque<T>::ListDeque(std::pmr::memory_resource* resource) : MutableListSequence<T>(resource) {}
+
+template <typename T>
+ListDeque<T>::ListDeque(T* items, int count, std::pmr::memory_resource* resource) : MutableListSequence<T>(items, count, resource) {}
+
+template <typename T>
+ListDeque<T>::ListDeque(const ListDeque<T>& other) : MutableListSequence<T>(other) {}
+
+template <typename T>
+ListDeque<T>::~ListDeque() = default;
+
+template <typename T>
+void ListDeque<T>::PushFront(const T& item) {
+    this->Prepend(item);
+}
+
+template <typename T>
+void ListDeque<T>::PushBack(const T& item) {
+    this->Append(item);
+}
+
+template <typename T>
+T ListDeque<T>::PopFront() {
+    if (this->IsEmpty()) throw Errors::EmptyList();
+    T val = this->GetFirst();
+    this->Remove(0);
+    return val;
+}
+
+template <typename T>
+T ListDeque<T>::PopBack() {
+    if (this->IsEmpty()) throw Errors::EmptyList();
+    T val = this->GetLast();
+    this->Remove(this->GetLength() - 1);
+    return val;
+}
+
+template <typename T>
+const T& ListDeque<T>::Front() const {
+    if (this->IsEmpty()) throw Errors::EmptyList();
+    return this->At(0);
+}
+
+template <typename T>
+const T& ListDeque<T>::Back() const {
+    if (this->IsEmpty()) throw Errors::EmptyList();
+    return this->At(this->GetLength() - 1);
+}
+
+template <typename T>
+Result<T> ListDeque<T>::TryPopFront() {
+    if (this->IsEmpty()) return ErrorCode::EMPTY_LIST;
+    T val = this->GetFirst();
+    this->Remove(0);
+    return val;
+}
+
+template <typename T>
+Result<T> ListDeque<T>::TryPopBack() {
+    if (this->IsEmpty()) return ErrorCode::EMPTY_LIST;
+    T val = this->GetLast();
+    this->Remove(this->GetLength() - 1);
+    return val;
+}
+
+template <typename T>
+Result<T> ListDeque<T>::TryFront() const {
+    return this->TryGetFirst();
+}
+
+template <typename T>
+Result<T> ListDeque<T>::TryBack() const {
+    return this->TryGetLast();
+}
+
+template <typename T>
+T ListDeque<T>::Get(int index) const {
+    return this->MutableListSequence<T>::Get(index);
+}
+
+template <typename T>
+int ListDeque<T>::GetLength() const {
+    return this->MutableListSequence<T>::GetLength();
+}
+
+template <typename T>
+bool ListDeque<T>::IsEmpty() const {
+    return this->GetLength() == 0;
 }
\ No newline at end of file
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <charconv>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "error.hpp"
+#include "Sequence.hpp"
+#include "User.hpp"
+#include "View.hpp"
+
+// Text dumps of whole containers. Dump::Write walks the container once
+// through View::From (lists by node, arrays by pointer), formats every item
+// into one 64 KiB buffer and hands the stream full blocks, so printing a list
+// is linear and costs a handful of write calls. Numbers go through
+// std::to_chars; User, Student and Professor have dedicated formatters that
+// print exactly what their operator<< prints. Other types fall back to
+// operator<< through a reused string stream.
+//
+// Options::offset and Options::limit print one page of a large container:
+//     Dump::Write(std::cout, seq, { 1000, 50 });   // items 1000..1049
+
+namespace Dump {
+
+    struct Options {
+        int offset = 0;
+        // Negative prints everything after offset.
+        int limit = -1;
+    };
+
+    class Buffer {
+    private:
+        static constexpr std::size_t Capacity = 64 * 1024;
+        // Longest to_chars result for any arithmetic type.
+        static constexpr std::size_t NumberRoom = 64;
+
+        std::ostream& out;
+        std::unique_ptr<char[]> buffer;
+        std::size_t used;
+        std::ostringstream fallback;
+
+        void Drain();
+
+    public:
+        explicit Buffer(std::ostream& out) : out(out), buffer(new char[Capacity]), used(0) {}
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+        // Flushes what is left; call Flush() first to see write errors.
+        ~Buffer();
+
+        void Put(char c);
+        void Put(std::string_view text);
+        template <class T>
+        void PutNumber(T value);
+        // Anything with an operator<<.
+        template <class T>
+        void PutStreamed(const T& value);
+        void Flush();
+    };
+
+    template <class T, class = void>
+    struct Formatter {
+        static void Format(Buffer& buffer, const T& item) { buffer.PutStreamed(item); }
+    };
+
+    template <class T>
+    struct Formatter<T, std::enable_if_t<std::is_arithmetic_v<T>>> {
+        static void Format(Buffer& buffer, T item) {
+            if constexpr (std::is_same_v<T, char>) buffer.Put(item);
+            else if constexpr (std::is_same_v<T, bool>) buffer.Put(item ? '1' : '0');
+            else buffer.PutNumber(item);
+        }
+    };
+
+    template <>
+    struct Formatter<std::string> {
+        static void Format(Buffer& buffer, const std::string& item) { buffer.Put(item); }
+    };
+
+    template <>
+    struct Formatter<User> {
+        static void Format(Buffer& buffer, const User& user) {
+            buffer.Put("User(name: ");
+            buffer.Put(user.name);
+            buffer.Put(", age: ");
+            buffer.PutNumber(user.age);
+            buffer.Put(", id: ");
+            buffer.PutNumber(user.id);
+            buffer.Put(')');
+        }
+    };
+
+    template <>
+    struct Formatter<Student> {
+        static void Format(Buffer& buffer, const Student& student) {
+            buffer.Put("Student ");
+            buffer.Put(student.name);
+            buffer.Put(", age: ");
+            buffer.PutNumber(student.age);
+            buffer.Put(", id: ");
+            buffer.PutNumber(student.id);
+            buffer.Put(", group: ");
+            buffer.Put(student.group);
+            buffer.Put(", Is cleared to exam: ");
+            buffer.Put(student.exam_pass ? '1' : '0');
+        }
+    };
+
+    template <>
+    struct Formatter<Professor> {
+        static void Format(Buffer& buffer, const Professor& teacher) {
+            buffer.Put("Professor ");
+            buffer.Put(teacher.name);
+            buffer.Put(", age: ");
+            buffer.PutNumber(teacher.age);
+            buffer.Put(", id: ");
+            buffer.PutNumber(teacher.id);
+            buffer.Put(", subject: ");
+            buffer.Put(teacher.subject);
+            buffer.Put(", Be on the exam: ");
+            buffer.Put(teacher.be_on_exam ? '1' : '0');
+        }
+    };
+
+
+    inline Buffer::~Buffer() {
+        if (used != 0) out.write(buffer.get(), std::streamsize(used));
+    }
+
+    inline void Buffer::Drain() {
+        out.write(buffer.get(), std::streamsize(used));
+        used = 0;
+        if (!out) throw Errors::IoError("write failed");
+    }
+
+    inline void Buffer::Flush() {
+        if (used != 0) Drain();
+        out.flush();
+        if (!out) throw Errors::IoError("write failed");
+    }
+
+    inline void Buffer::Put(char c) {
+        if (used == Capacity) Drain();
+        buffer[used++] = c;
+    }
+
+    inline void Buffer::Put(std::string_view text) {
+        if (used + text.size() > Capacity) {
+            Drain();
+            // Large blocks skip the buffer.
+            if (text.size() >= Capacity) {
+                out.write(text.data(), std::streamsize(text.size()));
+                if (!out) throw Errors::IoError("write failed");
+                return;
+            }
+        }
+        std::memcpy(buffer.get() + used, text.data(), text.size());
+        used += text.size();
+    }
+
+    // Floating point uses the stream default of six significant digits.
+    template <class T>
+    void Buffer::PutNumber(T value) {
+        if (used + NumberRoom > Capacity) Drain();
+        char* first = buffer.get() + used;
+        std::to_chars_result result;
+        if constexpr (std::is_floating_point_v<T>) result = std::to_chars(first, first + NumberRoom, value, std::chars_format::general, 6);
+        else result = std::to_chars(first, first + NumberRoom, value);
+        used += std::size_t(result.ptr - first);
+    }
+
+    template <class T>
+    void Buffer::PutStreamed(const T& value) {
+        fallback.str(std::string());
+        fallback << value;
+        Put(std::string_view(fallback.str()));
+    }
+
+
+    // Writes "[ a b c ]\n". A page that does not cover the whole container
+    // is followed by its position, e.g. "[ d e ] (items 3-4 of 10)\n".
+    template <class Source>
+    void Write(Buffer& buffer, const Source& source, int total, Options options = {}) {
+        using T = typename Source::value_type;
+        if (options.offset < 0) throw Errors::InvalidArgument("negative offset");
+
+        int first = options.offset < total ? options.offset : total;
+        int count = total - first;
+        if (options.limit >= 0 && options.limit < count) count = options.limit;
+
+        buffer.Put("[ ");
+        source.Skip(first).Take(count).ForEach([&buffer](const T& item) {
+            Formatter<T>::Format(buffer, item);
+            buffer.Put(' ');
+        });
+        buffer.Put(']');
+        if (count != total) {
+            buffer.Put(" (items ");
+            buffer.PutNumber(first);
+            buffer.Put('-');
+            buffer.PutNumber(count > 0 ? first + count - 1 : first);
+            buffer.Put(" of ");
+            buffer.PutNumber(total);
+            buffer.Put(')');
+        }
+        buffer.Put('\n');
+    }
+
+    template <class T>
+    void Write(std::ostream& out, const Sequence<T>& seq, Options options = {}) {
+        Buffer buffer(out);
+        Write(buffer, View::From(seq), seq.GetLength(), options);
+        buffer.Flush();
+    }
+}
\ No newline at end of file
@@ -1,169 +1,339 @@
-#pragma once
-
-#include <stdexcept>
-#include "error.hpp"
-
-template <class T>
-class DynamicArray {
-protected:
-    T* data;
-    int size;
-
-public:
-    DynamicArray(T* items, int count);
-    DynamicArray(int size);
-    DynamicArray(const DynamicArray<T>& arr);
-    ~DynamicArray();
-
-    T Get(int index) const;
-    T* GetRef(int index) const;
-    int GetSize() const;
-
-    void Remove(int index);
-
-    void Set(int index, T value);
-    void Resize(int newSize);
-    DynamicArray<T>* GetSubArray(int startIndex, int endIndex) const;
-
-
-    T& operator[](int index);
-    const T& operator[](int index) const;
-};
-
-template <class T>
-DynamicArray<T>::DynamicArray(T* items, int count) {
-    if (count < 0) throw Errors::NegativeSize();
-
-    size = count;
-
-    data = new T[size];
-    for (int i = 0; i < size; i++)
-        data[i] = items[i];
-}
-
-template <class T>
-DynamicArray<T>::DynamicArray(int size) {
-    if (size < 0) throw Errors::NegativeSize();
-
-    this->size = size;
-    data = new T[size];
-}
-
-template <class T>
-DynamicArray<T>::DynamicArray(const DynamicArray<T>& arr) {
-    size = arr.size;
-    data = new T[size];
-    for (int i = 0; i < size; i++)
-        data[i] = arr.data[i];
-}
-
-template <class T>
-DynamicArray<T>::~DynamicArray() = default;
-
-template <class T>
-T DynamicArray<T>::Get(int index) const {
-    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
-
-    return data[index];
-}
-
-template <class T>
-T* DynamicArray<T>::GetRef(int index) const {
-    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
-
-    T temp = data[index];
-
-    return &temp;
-}
-
-template <class T>
-int DynamicArray<T>::GetSize() const {
-
-    return size;
-}
-
-template <class T>
-void DynamicArray<T>::Remove(int index) {
-    if (size == 0) return;
-
-    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
-
-    if (index == size - 1) {
-        size--;
-        return;
-    }
-
-    T* newData = new T[size - 1];
-
-    for (int i = 0; i < index; ++i)
-        newData[i] = data[i];
-
-    for (int i = index + 1; i < size; ++i)
-        newData[i - 1] = data[i];
-
-    data = newData;
-
-    size--;
-}
-
-template <class T>
-void DynamicArray<T>::Set(int index, T value) {
-    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
-    data[index] = value;
-}
-
-template <class T>
-void DynamicArray<T>::Resize(int newSize) {
-    if (newSize < 0) throw Errors::NegativeSize();
-
-    T* newData = new T[newSize];
-
-    for (int i = 0; i < size; ++i)
-        newData[i] = data[i];
-
-    delete[] data;
-    data = newData;
-
-    size = newSize;
-}
-
-template <class T>
-DynamicArray<T>* DynamicArray<T>::GetSubArray(int startIndex, int endIndex) const {
-    if (startIndex < 0 || endIndex >= size || startIndex > endIndex)
-        throw Errors::InvalidIndices();
-
-    int count = endIndex - startIndex + 1;
-
-    DynamicArray<T>* result = new DynamicArray<T>(count);
-    for (int i = 0; i < count; ++i) {
-        result->Set(i, data[startIndex + i]);
-    }
-    return result;
-
-}
-
-
-template <class T>
-T& DynamicArray<T>::operator[](int index) {
-    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
-
-    return data[index];
-}
-
-template <class T>
-const T& DynamicArray<T>::operator[](int index) const {
-    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
-
-    return data[index];
-}
-
-template<typename T>
-bool operator==(const DynamicArray<T>& lhs, const DynamicArray<T>& rhs) {
-    if (lhs.GetSize() != rhs.GetSize()) return false;
-
-    for (int i = 0; i < lhs.GetSize(); ++i)
-
-        if (lhs.Get(i) != rhs.Get(i)) return false;
-
-    return true;
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "error.hpp"
+#include "Result.hpp"
+#include "BoundsPolicy.hpp"
+#include "SimdKernels.hpp"
+
+// Up to 16 items, or 128 bytes worth of them, are kept inside the array
+// object itself; only larger arrays allocate, from a std::pmr::memory_resource
+// (the default resource unless one is passed in). Copies use the default
+// resource and assignment keeps the target's, as with std::pmr containers.
+template <class T>
+constexpr int DefaultInlineCapacity = sizeof(T) * 16 <= 128 ? 16 : int(128 / sizeof(T));
+
+template <class T, class Policy = Checked, int InlineCapacity = DefaultInlineCapacity<T>>
+class DynamicArray {
+protected:
+    T* data;
+    int size;
+    int capacity;
+    std::pmr::memory_resource* resource;
+    alignas(T) unsigned char local[(InlineCapacity > 0 ? InlineCapacity : 1) * sizeof(T)];
+
+    T* Local() { return reinterpret_cast<T*>(local); }
+    T* Allocate(int count) { return static_cast<T*>(resource->allocate(sizeof(T) * count, alignof(T))); }
+    void Deallocate(T* block, int count) { resource->deallocate(block, sizeof(T) * count, alignof(T)); }
+    void Acquire(int count);
+    void Release();
+    void Steal(DynamicArray<T, Policy, InlineCapacity>& arr);
+
+public:
+    DynamicArray(const T* items, int count, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    DynamicArray(int size, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    DynamicArray(const DynamicArray<T, Policy, InlineCapacity>& arr);
+    DynamicArray(DynamicArray<T, Policy, InlineCapacity>&& arr) noexcept(std::is_nothrow_move_constructible_v<T>);
+    ~DynamicArray();
+
+    DynamicArray<T, Policy, InlineCapacity>& operator=(const DynamicArray<T, Policy, InlineCapacity>& arr);
+    DynamicArray<T, Policy, InlineCapacity>& operator=(DynamicArray<T, Policy, InlineCapacity>&& arr);
+
+    T Get(int index) const;
+    Result<T> TryGet(int index) const;
+    T* GetRef(int index) const;
+    T& At(int index);
+    const T& At(int index) const;
+    int GetSize() const;
+    int GetCapacity() const { return capacity; }
+    bool IsInline() const { return data == reinterpret_cast<const T*>(local); }
+    std::pmr::memory_resource* GetResource() const { return resource; }
+    T* Data();
+    const T* Data() const;
+
+    void Remove(int index);
+
+    void Set(int index, T value);
+    void Resize(int newSize);
+    DynamicArray<T, Policy, InlineCapacity>* GetSubArray(int startIndex, int endIndex) const;
+
+
+    T& operator[](int index);
+    const T& operator[](int index) const;
+};
+
+// Points data at storage for count items: the inline buffer if they fit,
+// otherwise a fresh heap block. Nothing is constructed yet.
+template <class T, class Policy, int N>
+void DynamicArray<T, Policy, N>::Acquire(int count) {
+    size = 0;
+    if (count <= N) {
+        data = Local();
+        capacity = N;
+    }
+    else {
+        data = Allocate(count);
+        capacity = count;
+    }
+}
+
+template <class T, class Policy, int N>
+void DynamicArray<T, Policy, N>::Release() {
+    std::destroy_n(data, size);
+    if (!IsInline()) Deallocate(data, capacity);
+    data = Local();
+    size = 0;
+    capacity = N;
+}
+
+// Takes over arr's items; *this must be empty, inline and use the same
+// resource. A heap block changes hands, inline items are moved one by one.
+template <class T, class Policy, int N>
+void DynamicArray<T, Policy, N>::Steal(DynamicArray<T, Policy, N>& arr) {
+    if (arr.IsInline()) {
+        std::uninitialized_move_n(arr.data, arr.size, data);
+        size = arr.size;
+        arr.Release();
+        return;
+    }
+
+    data = arr.data;
+    size = arr.size;
+    capacity = arr.capacity;
+    arr.data = arr.Local();
+    arr.size = 0;
+    arr.capacity = N;
+}
+
+template <class T, class Policy, int N>
+DynamicArray<T, Policy, N>::DynamicArray(const T* items, int count, std::pmr::memory_resource* resource) : resource(resource) {
+    if (count < 0) throw Errors::NegativeSize();
+
+    Acquire(count);
+    try {
+        std::uninitialized_copy_n(items, count, data);
+    }
+    catch (...) {
+        if (!IsInline()) Deallocate(data, capacity);
+        throw;
+    }
+    size = count;
+}
+
+template <class T, class Policy, int N>
+DynamicArray<T, Policy, N>::DynamicArray(int size, std::pmr::memory_resource* resource) : resource(resource) {
+    if (size < 0) throw Errors::NegativeSize();
+
+    Acquire(size);
+    try {
+        std::uninitialized_default_construct_n(data, size);
+    }
+    catch (...) {
+        if (!IsInline()) Deallocate(data, capacity);
+        throw;
+    }
+    this->size = size;
+}
+
+template <class T, class Policy, int N>
+DynamicArray<T, Policy, N>::DynamicArray(const DynamicArray<T, Policy, N>& arr) : DynamicArray(arr.data, arr.size) {}
+
+template <class T, class Policy, int N>
+DynamicArray<T, Policy, N>::DynamicArray(DynamicArray<T, Policy, N>&& arr) noexcept(std::is_nothrow_move_constructible_v<T>)
+    : data(Local()), size(0), capacity(N), resource(arr.resource) {
+    Steal(arr);
+}
+
+template <class T, class Policy, int N>
+DynamicArray<T, Policy, N>::~DynamicArray() {
+    Release();
+}
+
+template <class T, class Policy, int N>
+DynamicArray<T, Policy, N>& DynamicArray<T, Policy, N>::operator=(const DynamicArray<T, Policy, N>& arr) {
+    if (this == &arr) return *this;
+
+    if (arr.size > capacity) {
+        DynamicArray<T, Policy, N> copy(arr.data, arr.size, resource);
+        Release();
+        Steal(copy);
+        return *this;
+    }
+
+    int common = size < arr.size ? size : arr.size;
+    for (int i = 0; i < common; i++)
+        data[i] = arr.data[i];
+    if (arr.size > size)
+        std::uninitialized_copy_n(arr.data + size, arr.size - size, data + size);
+    else
+        std::destroy_n(data + arr.size, size - arr.size);
+    size = arr.size;
+    return *this;
+}
+
+template <class T, class Policy, int N>
+DynamicArray<T, Policy, N>& DynamicArray<T, Policy, N>::operator=(DynamicArray<T, Policy, N>&& arr) {
+    if (this == &arr) return *this;
+    if (!resource->is_equal(*arr.resource)) {
+        *this = static_cast<const DynamicArray<T, Policy, N>&>(arr);
+        arr.Release();
+        return *this;
+    }
+
+    Release();
+    Steal(arr);
+    return *this;
+}
+
+template <class T, class Policy, int N>
+T DynamicArray<T, Policy, N>::Get(int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    return data[index];
+}
+
+template <class T, class Policy, int N>
+Result<T> DynamicArray<T, Policy, N>::TryGet(int index) const {
+    if (index < 0 || index >= size) return ErrorCode::INDEX_OUT_OF_RANGE;
+
+    return data[index];
+}
+
+template <class T, class Policy, int N>
+T* DynamicArray<T, Policy, N>::GetRef(int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    return &data[index];
+}
+
+template <class T, class Policy, int N>
+T& DynamicArray<T, Policy, N>::At(int index) {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    return data[index];
+}
+
+template <class T, class Policy, int N>
+const T& DynamicArray<T, Policy, N>::At(int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    return data[index];
+}
+
+template <class T, class Policy, int N>
+int DynamicArray<T, Policy, N>::GetSize() const {
+
+    return size;
+}
+
+template <class T, class Policy, int N>
+T* DynamicArray<T, Policy, N>::Data() {
+
+    return data;
+}
+
+template <class T, class Policy, int N>
+const T* DynamicArray<T, Policy, N>::Data() const {
+
+    return data;
+}
+
+template <class T, class Policy, int N>
+void DynamicArray<T, Policy, N>::Remove(int index) {
+    if (size == 0) return;
+
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    for (int i = index + 1; i < size; ++i)
+        data[i - 1] = std::move(data[i]);
+
+    std::destroy_at(data + size - 1);
+    size--;
+}
+
+template <class T, class Policy, int N>
+void DynamicArray<T, Policy, N>::Set(int index, T value) {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    data[index] = value;
+}
+
+// Shrinking and growing within the current capacity work in place; growing
+// past it moves the items into a block of exactly newSize.
+template <class T, class Policy, int N>
+void DynamicArray<T, Policy, N>::Resize(int newSize) {
+    if (newSize < 0) throw Errors::NegativeSize();
+
+    if (newSize <= size) {
+        std::destroy_n(data + newSize, size - newSize);
+        size = newSize;
+        return;
+    }
+
+    if (newSize <= capacity) {
+        std::uninitialized_default_construct_n(data + size, newSize - size);
+        size = newSize;
+        return;
+    }
+
+    // Items whose move may throw are copied, so a failure leaves them intact.
+    T* newData = Allocate(newSize);
+    int relocated = 0;
+    try {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+            std::uninitialized_move_n(data, size, newData);
+        else
+            std::uninitialized_copy_n(data, size, newData);
+        relocated = size;
+        std::uninitialized_default_construct_n(newData + size, newSize - size);
+    }
+    catch (...) {
+        std::destroy_n(newData, relocated);
+        Deallocate(newData, newSize);
+        throw;
+    }
+
+    Release();
+    data = newData;
+    capacity = newSize;
+    size = newSize;
+}
+
+template <class T, class Policy, int N>
+DynamicArray<T, Policy, N>* DynamicArray<T, Policy, N>::GetSubArray(int startIndex, int endIndex) const {
+    Policy::Require(startIndex >= 0 && endIndex < size && startIndex <= endIndex, ErrorCode::INVALID_INDICES);
+
+    return new DynamicArray<T, Policy, N>(data + startIndex, endIndex - startIndex + 1);
+}
+
+
+template <class T, class Policy, int N>
+T& DynamicArray<T, Policy, N>::operator[](int index) {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    return data[index];
+}
+
+template <class T, class Policy, int N>
+const T& DynamicArray<T, Policy, N>::operator[](int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    return data[index];
+}
+
+template <class T, class Policy, int N>
+bool operator==(const DynamicArray<T, Policy, N>& lhs, const DynamicArray<T, Policy, N>& rhs) {
+    if (lhs.GetSize() != rhs.GetSize()) return false;
+
+    if constexpr (std::is_same_v<T, int> || std::is_same_v<T, double>)
+        return Simd::Equal(lhs.Data(), rhs.Data(), lhs.GetSize());
+
+    for (int i = 0; i < lhs.GetSize(); ++i)
+
+        if (!(lhs.At(i) == rhs.At(i))) return false;
+
+    return true;
 }
\ No newline at end of file
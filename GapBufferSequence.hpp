@@ -0,0 +1,235 @@
+#pragma once
+
+#include <utility>
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "BoundsPolicy.hpp"
+#include "Result.hpp"
+#include "error.hpp"
+
+// Array sequence with a movable gap of free slots at the last edit position.
+// Inserting or removing at the gap costs O(1); moving the gap costs the
+// distance it moves, so edits that cluster around a cursor stay cheap while
+// Get remains a single index adjustment.
+
+template <class T, class Policy = Checked>
+class GapBufferSequence : public Sequence<T> {
+private:
+    DynamicArray<T, Policy> buffer;
+    int gapStart;
+    int gapEnd;
+
+    int GapSize() const { return gapEnd - gapStart; }
+    int Physical(int index) const { return index < gapStart ? index : index + GapSize(); }
+    void MoveGap(int index);
+    void Grow(int minimumGap);
+
+public:
+    GapBufferSequence();
+    GapBufferSequence(T* items, int count);
+
+    T GetFirst() const override;
+    T GetLast() const override;
+    T Get(int index) const override;
+    Result<T> TryGetFirst() const override;
+    Result<T> TryGetLast() const override;
+    Result<T> TryGet(int index) const override;
+    int GetLength() const override;
+    T* GetRef(int index) const;
+    T& At(int index);
+    const T& At(int index) const override;
+
+    int GetGapPosition() const { return gapStart; }
+    void Reserve(int capacity);
+
+    Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
+    Sequence<T>* Concat(const Sequence<T>* other) const override;
+
+    Sequence<T>* Append(T item) override;
+    Sequence<T>* Prepend(T item) override;
+    Sequence<T>* InsertAt(T item, int index) override;
+    Sequence<T>* Remove(int index) override;
+
+    Sequence<T>* Instance() override;
+    Sequence<T>* Clone() const override;
+
+    template <class F>
+    void ForEach(F visit) const;
+};
+
+template <class T, class Policy>
+GapBufferSequence<T, Policy>::GapBufferSequence() : buffer(0), gapStart(0), gapEnd(0) {}
+
+template <class T, class Policy>
+GapBufferSequence<T, Policy>::GapBufferSequence(T* items, int count) : buffer(items, count), gapStart(count), gapEnd(count) {}
+
+template <class T, class Policy>
+void GapBufferSequence<T, Policy>::MoveGap(int index) {
+    T* data = buffer.Data();
+    if (index < gapStart) {
+        while (gapStart > index) data[--gapEnd] = std::move(data[--gapStart]);
+    }
+    else {
+        while (gapStart < index) data[gapStart++] = std::move(data[gapEnd++]);
+    }
+}
+
+template <class T, class Policy>
+void GapBufferSequence<T, Policy>::Grow(int minimumGap) {
+    int length = GetLength();
+    int capacity = buffer.GetSize();
+    int newCapacity = capacity < 16 ? 16 : capacity * 2;
+    if (newCapacity - length < minimumGap) newCapacity = length + minimumGap;
+
+    DynamicArray<T, Policy> grown(newCapacity);
+    T* target = grown.Data();
+    T* source = buffer.Data();
+    int tail = capacity - gapEnd;
+    for (int i = 0; i < gapStart; i++) target[i] = std::move(source[i]);
+    for (int i = 0; i < tail; i++) target[newCapacity - tail + i] = std::move(source[gapEnd + i]);
+
+    buffer = std::move(grown);
+    gapEnd = newCapacity - tail;
+}
+
+template <class T, class Policy>
+void GapBufferSequence<T, Policy>::Reserve(int capacity) {
+    if (capacity < 0) throw Errors::NegativeSize();
+    if (capacity > buffer.GetSize()) Grow(capacity - GetLength());
+}
+
+template <class T, class Policy>
+T GapBufferSequence<T, Policy>::GetFirst() const {
+    Policy::Require(GetLength() != 0, ErrorCode::EMPTY_ARRAY);
+    return buffer.Data()[Physical(0)];
+}
+
+template <class T, class Policy>
+T GapBufferSequence<T, Policy>::GetLast() const {
+    Policy::Require(GetLength() != 0, ErrorCode::EMPTY_ARRAY);
+    return buffer.Data()[Physical(GetLength() - 1)];
+}
+
+template <class T, class Policy>
+T GapBufferSequence<T, Policy>::Get(int index) const {
+    Policy::Require(index >= 0 && index < GetLength(), ErrorCode::INDEX_OUT_OF_RANGE);
+    return buffer.Data()[Physical(index)];
+}
+
+template <class T, class Policy>
+Result<T> GapBufferSequence<T, Policy>::TryGetFirst() const {
+    if (GetLength() == 0) return ErrorCode::EMPTY_ARRAY;
+    return buffer.Data()[Physical(0)];
+}
+
+template <class T, class Policy>
+Result<T> GapBufferSequence<T, Policy>::TryGetLast() const {
+    if (GetLength() == 0) return ErrorCode::EMPTY_ARRAY;
+    return buffer.Data()[Physical(GetLength() - 1)];
+}
+
+template <class T, class Policy>
+Result<T> GapBufferSequence<T, Policy>::TryGet(int index) const {
+    if (index < 0 || index >= GetLength()) return ErrorCode::INDEX_OUT_OF_RANGE;
+    return buffer.Data()[Physical(index)];
+}
+
+template <class T, class Policy>
+int GapBufferSequence<T, Policy>::GetLength() const {
+    return buffer.GetSize() - GapSize();
+}
+
+template <class T, class Policy>
+T* GapBufferSequence<T, Policy>::GetRef(int index) const {
+    Policy::Require(index >= 0 && index < GetLength(), ErrorCode::INDEX_OUT_OF_RANGE);
+    return const_cast<T*>(buffer.Data()) + Physical(index);
+}
+
+template <class T, class Policy>
+T& GapBufferSequence<T, Policy>::At(int index) {
+    Policy::Require(index >= 0 && index < GetLength(), ErrorCode::INDEX_OUT_OF_RANGE);
+    return buffer.Data()[Physical(index)];
+}
+
+template <class T, class Policy>
+const T& GapBufferSequence<T, Policy>::At(int index) const {
+    Policy::Require(index >= 0 && index < GetLength(), ErrorCode::INDEX_OUT_OF_RANGE);
+    return buffer.Data()[Physical(index)];
+}
+
+template <class T, class Policy>
+Sequence<T>* GapBufferSequence<T, Policy>::GetSubsequence(int startIndex, int endIndex) const {
+    Policy::Require(startIndex >= 0 && endIndex < GetLength() && startIndex <= endIndex, ErrorCode::INVALID_INDICES);
+
+    auto* result = new GapBufferSequence<T, Policy>();
+    result->Reserve(endIndex - startIndex + 1);
+    for (int i = startIndex; i <= endIndex; i++) result->Append(buffer.Data()[Physical(i)]);
+    return result;
+}
+
+template <class T, class Policy>
+Sequence<T>* GapBufferSequence<T, Policy>::Concat(const Sequence<T>* other) const {
+    auto otherBuffer = dynamic_cast<const GapBufferSequence<T, Policy>*>(other);
+    if (!otherBuffer) throw Errors::IncompatibleTypes();
+
+    auto* result = new GapBufferSequence<T, Policy>(*this);
+    result->Reserve(GetLength() + otherBuffer->GetLength());
+    otherBuffer->ForEach([result](const T& item) { result->Append(item); });
+    return result;
+}
+
+template <class T, class Policy>
+Sequence<T>* GapBufferSequence<T, Policy>::Append(T item) {
+    return InsertAt(item, GetLength());
+}
+
+template <class T, class Policy>
+Sequence<T>* GapBufferSequence<T, Policy>::Prepend(T item) {
+    return InsertAt(item, 0);
+}
+
+template <class T, class Policy>
+Sequence<T>* GapBufferSequence<T, Policy>::InsertAt(T item, int index) {
+    Policy::Require(index >= 0 && index <= GetLength(), ErrorCode::INDEX_OUT_OF_RANGE);
+
+    MoveGap(index);
+    if (GapSize() == 0) Grow(1);
+    buffer.Data()[gapStart++] = item;
+    return this;
+}
+
+template <class T, class Policy>
+Sequence<T>* GapBufferSequence<T, Policy>::Remove(int index) {
+    Policy::Require(GetLength() != 0, ErrorCode::EMPTY_ARRAY);
+    Policy::Require(index >= 0 && index < GetLength(), ErrorCode::INDEX_OUT_OF_RANGE);
+
+    // Deleting just before the gap (backspace) shrinks it from the left;
+    // anything else moves the gap to index and drops the item after it.
+    if (index == gapStart - 1) {
+        gapStart--;
+    }
+    else {
+        MoveGap(index);
+        gapEnd++;
+    }
+    return this;
+}
+
+template <class T, class Policy>
+Sequence<T>* GapBufferSequence<T, Policy>::Instance() {
+    return this;
+}
+
+template <class T, class Policy>
+Sequence<T>* GapBufferSequence<T, Policy>::Clone() const {
+    return new GapBufferSequence<T, Policy>(*this);
+}
+
+template <class T, class Policy>
+template <class F>
+void GapBufferSequence<T, Policy>::ForEach(F visit) const {
+    const T* data = buffer.Data();
+    for (int i = 0; i < gapStart; i++) visit(data[i]);
+    for (int i = gapEnd; i < buffer.GetSize(); i++) visit(data[i]);
+}
\ No newline at end of file
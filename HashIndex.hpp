@@ -0,0 +1,310 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "DynamicArray.hpp"
+#include "ArraySequence.hpp"
+#include "Sequence.hpp"
+#include "BoundsPolicy.hpp"
+#include "error.hpp"
+
+// Open-addressing map from unique keys to sequence positions, using Robin
+// Hood probing: an insert takes the slot of any entry that is closer to its
+// home bucket, which keeps probe lengths short and lets Find stop as soon as
+// it passes an entry richer than the key it looks for. Erase shifts the
+// following run back instead of leaving tombstones.
+
+template <class Key, class Hash = std::hash<Key>>
+class HashIndex {
+private:
+    struct Slot {
+        Key key;
+        int value;
+        int distance;
+
+        Slot() : key(), value(0), distance(-1) {}
+    };
+
+    DynamicArray<Slot> slots;
+    int count;
+    int shift;
+    Hash hash;
+
+    int Home(const Key& key) const;
+    int Mask() const { return slots.GetSize() - 1; }
+    int Locate(const Key& key) const;
+    void Place(Slot incoming);
+    void Rehash(int newCapacity);
+
+public:
+    HashIndex();
+
+    int GetSize() const { return count; }
+    int GetCapacity() const { return slots.GetSize(); }
+
+    void Reserve(int entries);
+    void Clear();
+
+    int Find(const Key& key) const;
+    bool Contains(const Key& key) const { return Locate(key) >= 0; }
+    bool Insert(const Key& key, int value);
+    bool Erase(const Key& key);
+
+    // Adds delta to every stored position that is >= from.
+    void ShiftValues(int from, int delta);
+};
+
+template <class Key, class Hash>
+HashIndex<Key, Hash>::HashIndex() : slots(0), count(0), shift(64), hash() {}
+
+template <class Key, class Hash>
+int HashIndex<Key, Hash>::Home(const Key& key) const {
+    std::uint64_t h = static_cast<std::uint64_t>(hash(key));
+    return static_cast<int>((h * 0x9E3779B97F4A7C15ull) >> shift);
+}
+
+template <class Key, class Hash>
+int HashIndex<Key, Hash>::Locate(const Key& key) const {
+    if (count == 0) return -1;
+
+    const Slot* data = slots.Data();
+    int mask = Mask();
+    int position = Home(key);
+    for (int distance = 0; ; distance++) {
+        const Slot& slot = data[position];
+        if (slot.distance < distance) return -1;
+        if (slot.key == key) return position;
+        position = (position + 1) & mask;
+    }
+}
+
+template <class Key, class Hash>
+void HashIndex<Key, Hash>::Place(Slot incoming) {
+    Slot* data = slots.Data();
+    int mask = Mask();
+    int position = Home(incoming.key);
+    incoming.distance = 0;
+    for (;;) {
+        Slot& slot = data[position];
+        if (slot.distance < 0) {
+            slot = std::move(incoming);
+            count++;
+            return;
+        }
+        if (slot.distance < incoming.distance) std::swap(slot, incoming);
+        position = (position + 1) & mask;
+        incoming.distance++;
+    }
+}
+
+template <class Key, class Hash>
+void HashIndex<Key, Hash>::Rehash(int newCapacity) {
+    int capacity = 8;
+    int bits = 3;
+    while (capacity < newCapacity) {
+        capacity *= 2;
+        bits++;
+    }
+
+    DynamicArray<Slot> old(capacity);
+    std::swap(old, slots);
+    shift = 64 - bits;
+    count = 0;
+
+    Slot* data = old.Data();
+    for (int i = 0; i < old.GetSize(); i++)
+        if (data[i].distance >= 0) Place(std::move(data[i]));
+}
+
+// Keeps the load factor at or below 7/8.
+template <class Key, class Hash>
+void HashIndex<Key, Hash>::Reserve(int entries) {
+    if (entries < 0) throw Errors::NegativeSize();
+    long long needed = (long long)entries * 8 / 7 + 1;
+    if (needed > GetCapacity()) Rehash(static_cast<int>(needed));
+}
+
+template <class Key, class Hash>
+void HashIndex<Key, Hash>::Clear() {
+    Slot* data = slots.Data();
+    for (int i = 0; i < slots.GetSize(); i++) data[i] = Slot();
+    count = 0;
+}
+
+template <class Key, class Hash>
+int HashIndex<Key, Hash>::Find(const Key& key) const {
+    int position = Locate(key);
+    return position < 0 ? -1 : slots.Data()[position].value;
+}
+
+template <class Key, class Hash>
+bool HashIndex<Key, Hash>::Insert(const Key& key, int value) {
+    if (Locate(key) >= 0) return false;
+    Reserve(count + 1);
+
+    Slot incoming;
+    incoming.key = key;
+    incoming.value = value;
+    Place(std::move(incoming));
+    return true;
+}
+
+template <class Key, class Hash>
+bool HashIndex<Key, Hash>::Erase(const Key& key) {
+    int position = Locate(key);
+    if (position < 0) return false;
+
+    Slot* data = slots.Data();
+    int mask = Mask();
+    for (int next = (position + 1) & mask; data[next].distance > 0; next = (next + 1) & mask) {
+        data[position] = std::move(data[next]);
+        data[position].distance--;
+        position = next;
+    }
+    data[position] = Slot();
+    count--;
+    return true;
+}
+
+template <class Key, class Hash>
+void HashIndex<Key, Hash>::ShiftValues(int from, int delta) {
+    Slot* data = slots.Data();
+    for (int i = 0; i < slots.GetSize(); i++)
+        if (data[i].distance >= 0 && data[i].value >= from) data[i].value += delta;
+}
+
+
+// MutableArraySequence that keeps a HashIndex from key(item) to position in
+// sync on Append, Prepend, InsertAt and Remove. Keys must be unique. Editing
+// an item's key through At() or GetRef() bypasses the index; call Reindex()
+// afterwards.
+template <class T, class KeyFn, class Policy = Checked>
+class IndexedArraySequence : public MutableArraySequence<T, Policy> {
+public:
+    using Key = std::decay_t<std::invoke_result_t<const KeyFn&, const T&>>;
+
+private:
+    using Base = MutableArraySequence<T, Policy>;
+
+    KeyFn key;
+    HashIndex<Key> index;
+
+    void RequireUnique(const Key& itemKey) const;
+
+public:
+    explicit IndexedArraySequence(KeyFn key);
+    IndexedArraySequence(const Sequence<T>& items, KeyFn key);
+
+    int Find(const Key& itemKey) const;
+    T* FindRef(const Key& itemKey);
+    const T* FindRef(const Key& itemKey) const;
+    bool Contains(const Key& itemKey) const { return index.Contains(itemKey); }
+    void Reindex();
+
+    Sequence<T>* Append(T item) override;
+    Sequence<T>* Prepend(T item) override;
+    Sequence<T>* InsertAt(T item, int position) override;
+    Sequence<T>* Remove(int position) override;
+
+    Sequence<T>* Clone() const override;
+
+    template <class Compare = std::less<T>>
+    void Sort(Compare cmp = Compare());
+    template <class SortKeyFn>
+    void SortByKey(SortKeyFn sortKey);
+};
+
+template <class T, class KeyFn, class Policy>
+IndexedArraySequence<T, KeyFn, Policy>::IndexedArraySequence(KeyFn key) : Base(), key(key), index() {}
+
+template <class T, class KeyFn, class Policy>
+IndexedArraySequence<T, KeyFn, Policy>::IndexedArraySequence(const Sequence<T>& items, KeyFn key) : Base(), key(key), index() {
+    index.Reserve(items.GetLength());
+    for (int i = 0; i < items.GetLength(); i++) Append(items.At(i));
+}
+
+template <class T, class KeyFn, class Policy>
+void IndexedArraySequence<T, KeyFn, Policy>::RequireUnique(const Key& itemKey) const {
+    if (index.Contains(itemKey)) throw Errors::InvalidArgument("duplicate key");
+}
+
+template <class T, class KeyFn, class Policy>
+int IndexedArraySequence<T, KeyFn, Policy>::Find(const Key& itemKey) const {
+    return index.Find(itemKey);
+}
+
+template <class T, class KeyFn, class Policy>
+T* IndexedArraySequence<T, KeyFn, Policy>::FindRef(const Key& itemKey) {
+    int position = index.Find(itemKey);
+    return position < 0 ? nullptr : this->Data() + position;
+}
+
+template <class T, class KeyFn, class Policy>
+const T* IndexedArraySequence<T, KeyFn, Policy>::FindRef(const Key& itemKey) const {
+    int position = index.Find(itemKey);
+    return position < 0 ? nullptr : this->Data() + position;
+}
+
+template <class T, class KeyFn, class Policy>
+void IndexedArraySequence<T, KeyFn, Policy>::Reindex() {
+    index.Clear();
+    index.Reserve(this->size);
+    const T* data = this->Data();
+    for (int i = 0; i < this->size; i++)
+        if (!index.Insert(key(data[i]), i)) throw Errors::InvalidArgument("duplicate key");
+}
+
+template <class T, class KeyFn, class Policy>
+Sequence<T>* IndexedArraySequence<T, KeyFn, Policy>::Append(T item) {
+    Key itemKey = key(item);
+    RequireUnique(itemKey);
+    Base::Append(item);
+    index.Insert(itemKey, this->size - 1);
+    return this;
+}
+
+template <class T, class KeyFn, class Policy>
+Sequence<T>* IndexedArraySequence<T, KeyFn, Policy>::Prepend(T item) {
+    return InsertAt(item, 0);
+}
+
+template <class T, class KeyFn, class Policy>
+Sequence<T>* IndexedArraySequence<T, KeyFn, Policy>::InsertAt(T item, int position) {
+    Key itemKey = key(item);
+    RequireUnique(itemKey);
+    Base::InsertAt(item, position);
+    if (position < this->size - 1) index.ShiftValues(position, 1);
+    index.Insert(itemKey, position);
+    return this;
+}
+
+template <class T, class KeyFn, class Policy>
+Sequence<T>* IndexedArraySequence<T, KeyFn, Policy>::Remove(int position) {
+    Key itemKey = key(this->Get(position));
+    Base::Remove(position);
+    index.Erase(itemKey);
+    if (position < this->size) index.ShiftValues(position + 1, -1);
+    return this;
+}
+
+template <class T, class KeyFn, class Policy>
+Sequence<T>* IndexedArraySequence<T, KeyFn, Policy>::Clone() const {
+    return new IndexedArraySequence<T, KeyFn, Policy>(*this);
+}
+
+template <class T, class KeyFn, class Policy>
+template <class Compare>
+void IndexedArraySequence<T, KeyFn, Policy>::Sort(Compare cmp) {
+    Base::Sort(cmp);
+    Reindex();
+}
+
+template <class T, class KeyFn, class Policy>
+template <class SortKeyFn>
+void IndexedArraySequence<T, KeyFn, Policy>::SortByKey(SortKeyFn sortKey) {
+    Base::SortByKey(sortKey);
+    Reindex();
+}
\ No newline at end of file
@@ -1,352 +1,667 @@
-#pragma once
-
-#include <iostream>
-#include <string>
-#include <vector>
-#include <limits>
-#include <typeinfo>
-
-#include "Stack.hpp"
-#include "Queue.hpp"
-#include "Deque.hpp"
-#include "User.hpp"
-#include "error.hpp"
-
-void ClearInput() {
-    std::cin.clear();
-    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-}
-
-int GetInt(const std::string& prompt = "") {
-    int v;
-    if (!prompt.empty()) std::cout << prompt;
-    if (!(std::cin >> v)) {
-        ClearInput();
-        throw Errors::InvalidArgument();
-    }
-    return v;
-}
-
-template<typename T>
-T GetTyped(const std::string& prompt = "Enter value: ") {
-    if (!prompt.empty()) std::cout << prompt;
-    T value{};
-    if (!(std::cin >> value)) {
-        ClearInput();
-        throw Errors::InvalidArgument();
-    }
-    return value;
-}
-
-
-
-template<>
-Student GetTyped<Student>(const std::string& prompt) { Student s; std::cin >> s; return s; }
-
-template<>
-Professor GetTyped<Professor>(const std::string& prompt) { Professor t; std::cin >> t; return t; }
-
-class IWrapper {
-public:
-    virtual ~IWrapper() = default;
-    virtual void ShowElements() const = 0;
-    virtual void Menu() = 0;
-    virtual std::string Info() const = 0;
-};
-
-
-enum class StructKind { STACK = 1, QUEUE, DEQUE };
-static inline std::string ToString(StructKind k) {
-    switch (k) {
-    case StructKind::STACK: return "stack";
-    case StructKind::QUEUE: return "queue";
-    case StructKind::DEQUE: return "deque";
-    }
-    return "?";
-}
-
-enum class Container { ARRAY = 1, LIST };
-static inline std::string ToString(Container c) {
-    return (c == Container::ARRAY ? "array" : "list");
-}
-
-
-template<typename T>
-class StackWrapper : public IWrapper {
-    Container c_;
-    std::string typeKey_;
-    Stack<T>* st_;
-
-    Stack<T>* makeStack() {
-        if (c_ == Container::ARRAY) return new ArrayStack<T>();
-        return new ListStack<T>();
-    }
-public:
-    StackWrapper(Container c, const std::string& key) : c_(c), typeKey_(key), st_(makeStack()) {}
-    ~StackWrapper() override { delete st_; }
-
-    
-    std::string Info() const override {
-        return "Stack<" + typeKey_ + ">(" + ToString(c_) + ", size=" + std::to_string(st_->GetLength()) + ")";
-    }
-
-    void ShowElements() const override {
-        std::cout << "[ ";
-        for (int i = 0; i < st_->GetLength(); ++i) std::cout << st_->Get(i) << " ";
-        std::cout << "]\n";
-    }
-
-    void Menu() override {
-        while (true) {
-            std::cout << "\n--- Stack menu ---\n";
-            std::cout << "1. Push\n2. Pop\n3. Top\n4. Show elements\n5. Back\nChoose: ";
-            try {
-                int ch = GetInt();
-                switch (ch) {
-                case 1: {
-                    T val = GetTyped<T>();
-                    st_->Push(val);
-                    break;
-                }
-                case 2: {
-                    T val = st_->Pop();
-                    std::cout << "Popped: " << val << "\n";
-                    break;
-                }
-                case 3: {
-                    std::cout << "Top: " << st_->Top() << "\n";
-                    break;
-                }
-                case 4: ShowElements(); break;
-                case 5: return; 
-                default: std::cout << "Invalid\n";
-                }
-            }
-            catch (const std::exception& e) { std::cout << "Error: " << e.what() << "\n"; }
-        }
-    }
-};
-
-
-
-template<typename T>
-class QueueWrapper : public IWrapper {
-    Container c_;
-    std::string typeKey_;
-    Queue<T>* q_;
-
-    Queue<T>* makeQueue() {
-        if (c_ == Container::ARRAY) return new ArrayQueue<T>();
-        return new ListQueue<T>();
-    }
-public:
-    QueueWrapper(Container c, const std::string& key) : c_(c), typeKey_(key), q_(makeQueue()) {}
-    ~QueueWrapper() override { delete q_; }
-
-    std::string Info() const override {
-        return "Queue<" + typeKey_ + ">(" + ToString(c_) + ", size=" + std::to_string(q_->GetLength()) + ")";
-    }
-
-    void ShowElements() const override {
-        std::cout << "[ ";
-        for (int i = 0; i < q_->GetLength(); ++i) std::cout << q_->Get(i) << " ";
-        std::cout << "]\n";
-    }
-
-    void Menu() override {
-        while (true) {
-            std::cout << "\n--- Queue menu ---\n";
-            std::cout << "1. Enqueue\n2. Dequeue\n3. Peek\n4. Show elements\n5. Back\nChoose: ";
-            try {
-                int ch = GetInt();
-                switch (ch) {
-                case 1: { 
-                    T val = GetTyped<T>();
-                    q_->Enqueue(val);
-                    break;
-                }
-                case 2: { 
-                    T val = q_->Dequeue();
-                    std::cout << "Dequeued: " << val << "\n";
-                    break;
-                }
-                case 3: { 
-                    std::cout << "Front element: " << q_->Peek() << "\n";
-                    break;
-                }
-                case 4: ShowElements(); break;
-                case 5: return;
-                default: std::cout << "Invalid\n"; break;
-                }
-            }
-            catch (const std::exception& e) { std::cout << "Error: " << e.what() << "\n"; }
-        }
-    }
-};
-
-
-
-template<typename T>
-class DequeWrapper : public IWrapper {
-    Container c_;
-    std::string typeKey_;
-    Deque<T>* d_;
-
-    Deque<T>* makeDeque() {
-        if (c_ == Container::ARRAY) return new ArrayDeque<T>();
-        return new ListDeque<T>();
-    }
-public:
-    DequeWrapper(Container c, const std::string& key) : c_(c), typeKey_(key), d_(makeDeque()) {}
-    ~DequeWrapper() override { delete d_; }
-
-    std::string Info() const override {
-        return "Deque<" + typeKey_ + ">(" + ToString(c_) + ", size=" + std::to_string(d_->GetLength()) + ")";
-    }
-
-    void ShowElements() const override {
-        std::cout << "[ ";
-        for (int i = 0; i < d_->GetLength(); ++i) std::cout << d_->Get(i) << " ";
-        std::cout << "]\n";
-    }
-
-    void Menu() override {
-        while (true) {
-            std::cout << "\n--- Deque menu ---\n";
-            std::cout << "1. PushFront\n2. PushBack\n3. PopFront\n4. PopBack\n5. Front\n6. Back\n7. Show elements\n8. Back to main\nChoose: ";
-            try {
-                int ch = GetInt();
-                switch (ch) {
-                case 1: d_->PushFront(GetTyped<T>()); break;
-                case 2: d_->PushBack(GetTyped<T>()); break;
-                case 3: std::cout << "PopFront: " << d_->PopFront() << "\n"; break;
-                case 4: std::cout << "PopBack: " << d_->PopBack() << "\n"; break;
-                case 5: std::cout << "Front: " << d_->Front() << "\n"; break;
-                case 6: std::cout << "Back: " << d_->Back() << "\n"; break;
-                case 7: ShowElements(); break;
-                case 8: return;
-                default: std::cout << "Invalid\n";
-                }
-            }
-            catch (const std::exception& e) { std::cout << "Error: " << e.what() << "\n"; }
-        }
-    }
-};
-
-
-struct TypeChoice {
-    int id; std::string name;
-};
-static const std::vector<TypeChoice> typeChoices = {
-    {1, "int"}, {2, "double"}, {3, "string"}, {4, "student"}, {5, "professor"}
-};
-
-void ShowTypeMenu() {
-    std::cout << "Select element type:\n";
-    for (auto t : typeChoices) std::cout << t.id << ". " << t.name << "\n";
-}
-
-Container AskContainer() {
-    std::cout << "Select container implementation:\n1. array\n2. list\nChoice: ";
-    int v = GetInt();
-    if (v == 1) return Container::ARRAY;
-    if (v == 2) return Container::LIST;
-    throw Errors::InvalidArgument();
-}
-
-StructKind AskStructKind() {
-    std::cout << "Select data structure:\n1. stack\n2. queue\n3. deque\nChoice: ";
-    int v = GetInt();
-    if (v >= 1 && v <= 3) return static_cast<StructKind>(v);
-    throw Errors::InvalidArgument();
-}
-
-IWrapper* CreateWrapper() {
-    StructKind sk = AskStructKind();
-    Container cont = AskContainer();
-    ShowTypeMenu();
-    int typeId = GetInt("Choice: ");
-
-    switch (typeId) {
-    case 1: { 
-        if (sk == StructKind::STACK) return new StackWrapper<int>(cont, "int");
-        if (sk == StructKind::QUEUE) return new QueueWrapper<int>(cont, "int");
-        return new DequeWrapper<int>(cont, "int");
-    }
-    case 2: { 
-        if (sk == StructKind::STACK) return new StackWrapper<double>(cont, "double");
-        if (sk == StructKind::QUEUE) return new QueueWrapper<double>(cont, "double");
-        return new DequeWrapper<double>(cont, "double");
-    }
-    case 3: { 
-        if (sk == StructKind::STACK) return new StackWrapper<std::string>(cont, "string");
-        if (sk == StructKind::QUEUE) return new QueueWrapper<std::string>(cont, "string");
-        return new DequeWrapper<std::string>(cont, "string");
-    }
-    case 4: { 
-        if (sk == StructKind::STACK) return new StackWrapper<Student>(cont, "student");
-        if (sk == StructKind::QUEUE) return new QueueWrapper<Student>(cont, "student");
-        return new DequeWrapper<Student>(cont, "student");
-    }
-    case 5: { 
-        if (sk == StructKind::STACK) return new StackWrapper<Professor>(cont, "professor");
-        if (sk == StructKind::QUEUE) return new QueueWrapper<Professor>(cont, "professor");
-        return new DequeWrapper<Professor>(cont, "professor");
-    }
-    default: throw Errors::InvalidArgument();
-    }
-}
-
-
-void Run() {
-    std::vector<IWrapper*> structs;
-    while (true) {
-        std::cout << "\n==== Main menu ====\n";
-        std::cout << "1. List structures\n2. Add structure\n3. Work with structure\n4. Remove structure\n5. Exit\nChoose: ";
-        try {
-            int choice = GetInt();
-            switch (choice) {
-            case 1: { 
-                if (structs.empty()) { std::cout << "No structures yet.\n"; break; }
-                for (size_t i = 0; i < structs.size(); ++i) {
-                    std::cout << i << ": " << structs[i]->Info() << "\n";
-                    structs[i]->ShowElements();
-                }
-                break;
-            }
-            case 2: { 
-                structs.push_back(CreateWrapper());
-                std::cout << "Structure added as index " << structs.size() - 1 << "\n";
-                break;
-            }
-            case 3: { 
-                if (structs.empty()) { std::cout << "No structures yet.\n"; break; }
-                std::cout << "Available indices: 0 to " << structs.size() - 1 << "\n";
-                int idx = GetInt("Index: ");
-                if (idx < 0 || static_cast<size_t>(idx) >= structs.size()) throw Errors::IndexOutOfRange();
-                structs[idx]->Menu();
-                break;
-            }
-            case 4: { 
-                if (structs.empty()) { std::cout << "Nothing to remove.\n"; break; }
-                std::cout << "Available indices: 0 to " << structs.size() - 1 << "\n";
-                int idx = GetInt("Index to remove: ");
-                if (idx < 0 || static_cast<size_t>(idx) >= structs.size()) throw Errors::IndexOutOfRange();
-                delete structs[idx];
-                structs.erase(structs.begin() + idx);
-                std::cout << "Removed.\n";
-                break;
-            }
-            case 5: { 
-                for (auto* p : structs) delete p;
-                std::cout << "Exiting...\n";
-                return;
-            }
-            default: std::cout << "Invalid choice.\n";
-            }
-        }
-        catch (const std::exception& e) {
-            std::cout << "Error: " << e.what() << "\n";
-        }
-    }
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <limits>
+#include <typeinfo>
+#include <type_traits>
+#include <utility>
+
+#include "Stack.hpp"
+#include "Queue.hpp"
+#include "Deque.hpp"
+#include "User.hpp"
+#include "error.hpp"
+#include "Trace.hpp"
+#include "Dump.hpp"
+
+void ClearInput() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+int GetInt(const std::string& prompt = "") {
+    int v;
+    if (!prompt.empty()) std::cout << prompt;
+    if (!(std::cin >> v)) {
+        ClearInput();
+        throw Errors::InvalidArgument();
+    }
+    return v;
+}
+
+template<typename T>
+T GetTyped(const std::string& prompt = "Enter value: ") {
+    if (!prompt.empty()) std::cout << prompt;
+    T value{};
+    if (!(std::cin >> value)) {
+        ClearInput();
+        throw Errors::InvalidArgument();
+    }
+    return value;
+}
+
+
+
+template<>
+Student GetTyped<Student>(const std::string& prompt) { Student s; std::cin >> s; return s; }
+
+template<>
+Professor GetTyped<Professor>(const std::string& prompt) { Professor t; std::cin >> t; return t; }
+
+// Script arguments are read without prompts; records are given field by field.
+template<typename T>
+T ReadArgument(std::istream& args) {
+    T value{};
+    if (!(args >> value)) throw Errors::InvalidArgument("missing or malformed value");
+    return value;
+}
+
+template<>
+Student ReadArgument<Student>(std::istream& args) {
+    Student s;
+    if (!(args >> s.name >> s.age >> s.id >> s.group >> s.exam_pass)) throw Errors::InvalidArgument("expected: name age id group pass");
+    return s;
+}
+
+template<>
+Professor ReadArgument<Professor>(std::istream& args) {
+    Professor t;
+    if (!(args >> t.name >> t.age >> t.id >> t.subject >> t.be_on_exam)) throw Errors::InvalidArgument("expected: name age id subject on_exam");
+    return t;
+}
+
+// "show [offset [limit]]" prints one page of a structure.
+Dump::Options ReadPage(std::istream& args) {
+    Dump::Options page;
+    if (args >> page.offset) {
+        if (page.offset < 0) throw Errors::InvalidArgument("negative offset");
+        args >> page.limit;
+    }
+    return page;
+}
+
+// Adds up the time spent inside structure calls, so a script's timings
+// leave out argument parsing and result formatting.
+struct CommandClock {
+    double ms = 0;
+
+    template <class F>
+    auto Measure(F&& call) -> decltype(call());
+};
+
+template <class F>
+auto CommandClock::Measure(F&& call) -> decltype(call()) {
+    auto t1 = std::chrono::steady_clock::now();
+    if constexpr (std::is_void_v<decltype(call())>) {
+        call();
+        ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t1).count();
+    }
+    else {
+        auto result = call();
+        ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t1).count();
+        return result;
+    }
+}
+
+class IWrapper {
+public:
+    virtual ~IWrapper() = default;
+    virtual void ShowElements() const = 0;
+    virtual void Menu() = 0;
+    virtual std::string Info() const = 0;
+    // Runs one script command against the structure, writing any result to
+    // out. Returns false if the structure has no such command.
+    virtual bool Execute(const std::string& command, std::istream& args, std::ostream& out, CommandClock& clock) = 0;
+};
+
+
+enum class StructKind { STACK = 1, QUEUE, DEQUE };
+static inline std::string ToString(StructKind k) {
+    switch (k) {
+    case StructKind::STACK: return "stack";
+    case StructKind::QUEUE: return "queue";
+    case StructKind::DEQUE: return "deque";
+    }
+    return "?";
+}
+
+enum class Container { ARRAY = 1, LIST };
+static inline std::string ToString(Container c) {
+    return (c == Container::ARRAY ? "array" : "list");
+}
+
+
+template<typename T>
+class StackWrapper : public IWrapper {
+    Container c_;
+    std::string typeKey_;
+    Stack<T>* st_;
+
+    Stack<T>* makeStack() {
+        if (c_ == Container::ARRAY) return new ArrayStack<T>();
+        return new ListStack<T>();
+    }
+public:
+    StackWrapper(Container c, const std::string& key) : c_(c), typeKey_(key), st_(makeStack()) {}
+    ~StackWrapper() override { delete st_; }
+
+    
+    std::string Info() const override {
+        return "Stack<" + typeKey_ + ">(" + ToString(c_) + ", size=" + std::to_string(st_->GetLength()) + ")";
+    }
+
+    void PrintElements(std::ostream& out, Dump::Options page = {}) const {
+        Dump::Write(out, dynamic_cast<const Sequence<T>&>(*st_), page);
+    }
+
+    void ShowElements() const override { PrintElements(std::cout); }
+
+    bool Execute(const std::string& command, std::istream& args, std::ostream& out, CommandClock& clock) override {
+        if (command == "push") {
+            T value = ReadArgument<T>(args);
+            clock.Measure([&] { st_->Push(std::move(value)); });
+        }
+        else if (command == "pop") out << clock.Measure([&] { return st_->Pop(); }) << "\n";
+        else if (command == "top") out << clock.Measure([&] { return st_->Top(); }) << "\n";
+        else if (command == "size") out << clock.Measure([&] { return st_->GetLength(); }) << "\n";
+        else if (command == "show") {
+            Dump::Options page = ReadPage(args);
+            clock.Measure([&] { PrintElements(out, page); });
+        }
+        else return false;
+        return true;
+    }
+
+    void Menu() override {
+        while (true) {
+            std::cout << "\n--- Stack menu ---\n";
+            std::cout << "1. Push\n2. Pop\n3. Top\n4. Show elements\n5. Back\nChoose: ";
+            try {
+                int ch = GetInt();
+                switch (ch) {
+                case 1: {
+                    T val = GetTyped<T>();
+                    st_->Push(val);
+                    break;
+                }
+                case 2: {
+                    T val = st_->Pop();
+                    std::cout << "Popped: " << val << "\n";
+                    break;
+                }
+                case 3: {
+                    std::cout << "Top: " << st_->Top() << "\n";
+                    break;
+                }
+                case 4: ShowElements(); break;
+                case 5: return; 
+                default: std::cout << "Invalid\n";
+                }
+            }
+            catch (const std::exception& e) { std::cout << "Error: " << e.what() << "\n"; }
+        }
+    }
+};
+
+
+
+template<typename T>
+class QueueWrapper : public IWrapper {
+    Container c_;
+    std::string typeKey_;
+    Queue<T>* q_;
+
+    Queue<T>* makeQueue() {
+        if (c_ == Container::ARRAY) return new ArrayQueue<T>();
+        return new ListQueue<T>();
+    }
+public:
+    QueueWrapper(Container c, const std::string& key) : c_(c), typeKey_(key), q_(makeQueue()) {}
+    ~QueueWrapper() override { delete q_; }
+
+    std::string Info() const override {
+        return "Queue<" + typeKey_ + ">(" + ToString(c_) + ", size=" + std::to_string(q_->GetLength()) + ")";
+    }
+
+    void PrintElements(std::ostream& out, Dump::Options page = {}) const {
+        Dump::Write(out, dynamic_cast<const Sequence<T>&>(*q_), page);
+    }
+
+    void ShowElements() const override { PrintElements(std::cout); }
+
+    bool Execute(const std::string& command, std::istream& args, std::ostream& out, CommandClock& clock) override {
+        if (command == "enqueue") {
+            T value = ReadArgument<T>(args);
+            clock.Measure([&] { q_->Enqueue(std::move(value)); });
+        }
+        else if (command == "dequeue") out << clock.Measure([&] { return q_->Dequeue(); }) << "\n";
+        else if (command == "peek" || command == "front") out << clock.Measure([&] { return q_->Front(); }) << "\n";
+        else if (command == "back") out << clock.Measure([&] { return q_->Back(); }) << "\n";
+        else if (command == "size") out << clock.Measure([&] { return q_->GetLength(); }) << "\n";
+        else if (command == "show") {
+            Dump::Options page = ReadPage(args);
+            clock.Measure([&] { PrintElements(out, page); });
+        }
+        else return false;
+        return true;
+    }
+
+    void Menu() override {
+        while (true) {
+            std::cout << "\n--- Queue menu ---\n";
+            std::cout << "1. Enqueue\n2. Dequeue\n3. Peek\n4. Show elements\n5. Back\nChoose: ";
+            try {
+                int ch = GetInt();
+                switch (ch) {
+                case 1: { 
+                    T val = GetTyped<T>();
+                    q_->Enqueue(val);
+                    break;
+                }
+                case 2: { 
+                    T val = q_->Dequeue();
+                    std::cout << "Dequeued: " << val << "\n";
+                    break;
+                }
+                case 3: { 
+                    std::cout << "Front element: " << q_->Peek() << "\n";
+                    break;
+                }
+                case 4: ShowElements(); break;
+                case 5: return;
+                default: std::cout << "Invalid\n"; break;
+                }
+            }
+            catch (const std::exception& e) { std::cout << "Error: " << e.what() << "\n"; }
+        }
+    }
+};
+
+
+
+template<typename T>
+class DequeWrapper : public IWrapper {
+    Container c_;
+    std::string typeKey_;
+    Deque<T>* d_;
+
+    Deque<T>* makeDeque() {
+        if (c_ == Container::ARRAY) return new ArrayDeque<T>();
+        return new ListDeque<T>();
+    }
+public:
+    DequeWrapper(Container c, const std::string& key) : c_(c), typeKey_(key), d_(makeDeque()) {}
+    ~DequeWrapper() override { delete d_; }
+
+    std::string Info() const override {
+        return "Deque<" + typeKey_ + ">(" + ToString(c_) + ", size=" + std::to_string(d_->GetLength()) + ")";
+    }
+
+    void PrintElements(std::ostream& out, Dump::Options page = {}) const {
+        Dump::Write(out, dynamic_cast<const Sequence<T>&>(*d_), page);
+    }
+
+    void ShowElements() const override { PrintElements(std::cout); }
+
+    bool Execute(const std::string& command, std::istream& args, std::ostream& out, CommandClock& clock) override {
+        if (command == "push_front" || command == "push_back") {
+            T value = ReadArgument<T>(args);
+            if (command == "push_front") clock.Measure([&] { d_->PushFront(std::move(value)); });
+            else clock.Measure([&] { d_->PushBack(std::move(value)); });
+        }
+        else if (command == "pop_front") out << clock.Measure([&] { return d_->PopFront(); }) << "\n";
+        else if (command == "pop_back") out << clock.Measure([&] { return d_->PopBack(); }) << "\n";
+        else if (command == "front") out << clock.Measure([&] { return d_->Front(); }) << "\n";
+        else if (command == "back") out << clock.Measure([&] { return d_->Back(); }) << "\n";
+        else if (command == "size") out << clock.Measure([&] { return d_->GetLength(); }) << "\n";
+        else if (command == "show") {
+            Dump::Options page = ReadPage(args);
+            clock.Measure([&] { PrintElements(out, page); });
+        }
+        else return false;
+        return true;
+    }
+
+    void Menu() override {
+        while (true) {
+            std::cout << "\n--- Deque menu ---\n";
+            std::cout << "1. PushFront\n2. PushBack\n3. PopFront\n4. PopBack\n5. Front\n6. Back\n7. Show elements\n8. Back to main\nChoose: ";
+            try {
+                int ch = GetInt();
+                switch (ch) {
+                case 1: d_->PushFront(GetTyped<T>()); break;
+                case 2: d_->PushBack(GetTyped<T>()); break;
+                case 3: std::cout << "PopFront: " << d_->PopFront() << "\n"; break;
+                case 4: std::cout << "PopBack: " << d_->PopBack() << "\n"; break;
+                case 5: std::cout << "Front: " << d_->Front() << "\n"; break;
+                case 6: std::cout << "Back: " << d_->Back() << "\n"; break;
+                case 7: ShowElements(); break;
+                case 8: return;
+                default: std::cout << "Invalid\n";
+                }
+            }
+            catch (const std::exception& e) { std::cout << "Error: " << e.what() << "\n"; }
+        }
+    }
+};
+
+
+struct TypeChoice {
+    int id; std::string name;
+};
+static const std::vector<TypeChoice> typeChoices = {
+    {1, "int"}, {2, "double"}, {3, "string"}, {4, "student"}, {5, "professor"}
+};
+
+void ShowTypeMenu() {
+    std::cout << "Select element type:\n";
+    for (auto t : typeChoices) std::cout << t.id << ". " << t.name << "\n";
+}
+
+Container AskContainer() {
+    std::cout << "Select container implementation:\n1. array\n2. list\nChoice: ";
+    int v = GetInt();
+    if (v == 1) return Container::ARRAY;
+    if (v == 2) return Container::LIST;
+    throw Errors::InvalidArgument();
+}
+
+StructKind AskStructKind() {
+    std::cout << "Select data structure:\n1. stack\n2. queue\n3. deque\nChoice: ";
+    int v = GetInt();
+    if (v >= 1 && v <= 3) return static_cast<StructKind>(v);
+    throw Errors::InvalidArgument();
+}
+
+IWrapper* MakeWrapper(StructKind sk, Container cont, int typeId) {
+    switch (typeId) {
+    case 1: { 
+        if (sk == StructKind::STACK) return new StackWrapper<int>(cont, "int");
+        if (sk == StructKind::QUEUE) return new QueueWrapper<int>(cont, "int");
+        return new DequeWrapper<int>(cont, "int");
+    }
+    case 2: { 
+        if (sk == StructKind::STACK) return new StackWrapper<double>(cont, "double");
+        if (sk == StructKind::QUEUE) return new QueueWrapper<double>(cont, "double");
+        return new DequeWrapper<double>(cont, "double");
+    }
+    case 3: { 
+        if (sk == StructKind::STACK) return new StackWrapper<std::string>(cont, "string");
+        if (sk == StructKind::QUEUE) return new QueueWrapper<std::string>(cont, "string");
+        return new DequeWrapper<std::string>(cont, "string");
+    }
+    case 4: { 
+        if (sk == StructKind::STACK) return new StackWrapper<Student>(cont, "student");
+        if (sk == StructKind::QUEUE) return new QueueWrapper<Student>(cont, "student");
+        return new DequeWrapper<Student>(cont, "student");
+    }
+    case 5: { 
+        if (sk == StructKind::STACK) return new StackWrapper<Professor>(cont, "professor");
+        if (sk == StructKind::QUEUE) return new QueueWrapper<Professor>(cont, "professor");
+        return new DequeWrapper<Professor>(cont, "professor");
+    }
+    default: throw Errors::InvalidArgument();
+    }
+}
+
+IWrapper* CreateWrapper() {
+    StructKind sk = AskStructKind();
+    Container cont = AskContainer();
+    ShowTypeMenu();
+    int typeId = GetInt("Choice: ");
+    return MakeWrapper(sk, cont, typeId);
+}
+
+
+void Run() {
+    std::vector<IWrapper*> structs;
+    while (true) {
+        std::cout << "\n==== Main menu ====\n";
+        std::cout << "1. List structures\n2. Add structure\n3. Work with structure\n4. Remove structure\n5. Exit\nChoose: ";
+        try {
+            int choice = GetInt();
+            switch (choice) {
+            case 1: { 
+                if (structs.empty()) { std::cout << "No structures yet.\n"; break; }
+                for (size_t i = 0; i < structs.size(); ++i) {
+                    std::cout << i << ": " << structs[i]->Info() << "\n";
+                    structs[i]->ShowElements();
+                }
+                break;
+            }
+            case 2: { 
+                structs.push_back(CreateWrapper());
+                std::cout << "Structure added as index " << structs.size() - 1 << "\n";
+                break;
+            }
+            case 3: { 
+                if (structs.empty()) { std::cout << "No structures yet.\n"; break; }
+                std::cout << "Available indices: 0 to " << structs.size() - 1 << "\n";
+                int idx = GetInt("Index: ");
+                if (idx < 0 || static_cast<size_t>(idx) >= structs.size()) throw Errors::IndexOutOfRange();
+                structs[idx]->Menu();
+                break;
+            }
+            case 4: { 
+                if (structs.empty()) { std::cout << "Nothing to remove.\n"; break; }
+                std::cout << "Available indices: 0 to " << structs.size() - 1 << "\n";
+                int idx = GetInt("Index to remove: ");
+                if (idx < 0 || static_cast<size_t>(idx) >= structs.size()) throw Errors::IndexOutOfRange();
+                delete structs[idx];
+                structs.erase(structs.begin() + idx);
+                std::cout << "Removed.\n";
+                break;
+            }
+            case 5: { 
+                for (auto* p : structs) delete p;
+                std::cout << "Exiting...\n";
+                return;
+            }
+            default: std::cout << "Invalid choice.\n";
+            }
+        }
+        catch (const std::exception& e) {
+            std::cout << "Error: " << e.what() << "\n";
+        }
+    }
+}
+
+// Script mode: one command per line, no prompts. Besides the commands of
+// the selected structure (push, pop, enqueue, pop_front, size, show with an
+// optional offset and limit, ...):
+//     new <stack|queue|deque> <array|list> <int|double|string|student|professor>
+//     use <index>
+//     list
+// Blank lines and lines starting with '#' are skipped. A failing command
+// reports its line and the script goes on.
+struct ScriptOptions {
+    bool overrideContainer = false;
+    Container container = Container::ARRAY;
+};
+
+struct CommandTiming {
+    long long count = 0;
+    double totalMs = 0;
+};
+
+struct ScriptStats {
+    int commands = 0;
+    int errors = 0;
+    std::map<std::string, CommandTiming> timings;
+};
+
+template <class Value>
+Value ParseName(const std::string& name, const std::vector<std::pair<std::string, Value>>& names) {
+    for (const auto& entry : names)
+        if (entry.first == name) return entry.second;
+    throw Errors::InvalidArgument("unknown name '" + name + "'");
+}
+
+IWrapper* MakeWrapper(std::istream& args, const ScriptOptions& options) {
+    std::string kind, container, type;
+    if (!(args >> kind >> container >> type)) throw Errors::InvalidArgument("expected: new <kind> <container> <type>");
+
+    StructKind sk = ParseName<StructKind>(kind, { {"stack", StructKind::STACK}, {"queue", StructKind::QUEUE}, {"deque", StructKind::DEQUE} });
+    Container cont = ParseName<Container>(container, { {"array", Container::ARRAY}, {"list", Container::LIST} });
+    if (options.overrideContainer) cont = options.container;
+    for (const auto& choice : typeChoices)
+        if (choice.name == type) return MakeWrapper(sk, cont, choice.id);
+    throw Errors::InvalidArgument("unknown type '" + type + "'");
+}
+
+// Output is collected and written to out in large pieces. Timings cover
+// the structure calls only: arguments are parsed and results printed
+// outside the clock. "show" is the exception, since the dump formats each
+// item as it walks the structure; its time includes the formatting.
+ScriptStats RunScript(std::istream& in, std::ostream& out, const ScriptOptions& options = {}) {
+    constexpr std::streamoff FlushThreshold = 64 * 1024;
+
+    ScriptStats stats;
+    std::vector<IWrapper*> structs;
+    IWrapper* current = nullptr;
+    std::ostringstream pending;
+    std::istringstream args;
+    std::string line, command;
+
+    for (int lineNumber = 1; std::getline(in, line); ++lineNumber) {
+        args.clear();
+        args.str(line);
+        if (!(args >> command) || command[0] == '#') continue;
+
+        stats.commands++;
+        try {
+            if (command == "new") {
+                structs.push_back(MakeWrapper(args, options));
+                current = structs.back();
+            }
+            else if (command == "use") {
+                int idx;
+                if (!(args >> idx)) throw Errors::InvalidArgument("expected: use <index>");
+                if (idx < 0 || static_cast<size_t>(idx) >= structs.size()) throw Errors::IndexOutOfRange();
+                current = structs[idx];
+            }
+            else if (command == "list") {
+                for (size_t i = 0; i < structs.size(); ++i) pending << i << ": " << structs[i]->Info() << "\n";
+            }
+            else {
+                if (current == nullptr) throw Errors::InvalidArgument("no structure selected");
+                CommandClock clock;
+                if (!current->Execute(command, args, pending, clock)) throw Errors::InvalidArgument("unknown command '" + command + "'");
+
+                CommandTiming& timing = stats.timings[command];
+                timing.count++;
+                timing.totalMs += clock.ms;
+            }
+        }
+        catch (const std::exception& e) {
+            stats.errors++;
+            pending << "line " << lineNumber << ": error: " << e.what() << "\n";
+        }
+
+        if (pending.tellp() > FlushThreshold) {
+            out << pending.str();
+            pending.str("");
+        }
+    }
+
+    out << pending.str();
+    out.flush();
+    for (auto* p : structs) delete p;
+    return stats;
+}
+
+void PrintTimings(const ScriptStats& stats, std::ostream& report) {
+    report << stats.commands << " commands, " << stats.errors << " errors\n";
+    for (const auto& [command, timing] : stats.timings) {
+        report << command << ": " << timing.count << " calls, " << timing.totalMs << " ms total, "
+            << timing.totalMs * 1000.0 / timing.count << " us avg\n";
+    }
+}
+
+// Replays an int trace (see Trace.hpp) on the array and list backends, or
+// only on the one given, and prints a report for each.
+int ReplayTraceFile(const std::string& path, const ScriptOptions& options, std::ostream& out) {
+    Tracing::Trace<int> trace = Tracing::LoadTrace<int>(path);
+    for (Container backend : { Container::ARRAY, Container::LIST }) {
+        if (options.overrideContainer && backend != options.container) continue;
+
+        CountingResource memory;
+        Tracing::ReplayReport report;
+        bool array = backend == Container::ARRAY;
+        if (trace.kind == Tracing::TraceKind::STACK) {
+            ArrayStack<int> arrayStack(&memory);
+            ListStack<int> listStack(&memory);
+            report = array ? Tracing::Replay(trace, arrayStack, &memory) : Tracing::Replay(trace, listStack, &memory);
+        }
+        else if (trace.kind == Tracing::TraceKind::QUEUE) {
+            ArrayQueue<int> arrayQueue(&memory);
+            ListQueue<int> listQueue(&memory);
+            report = array ? Tracing::Replay(trace, arrayQueue, &memory) : Tracing::Replay(trace, listQueue, &memory);
+        }
+        else {
+            ArrayDeque<int> arrayDeque(&memory);
+            ListDeque<int> listDeque(&memory);
+            report = array ? Tracing::Replay(trace, arrayDeque, &memory) : Tracing::Replay(trace, listDeque, &memory);
+        }
+        out << ToString(backend) << ": ";
+        Tracing::PrintReport(report, out);
+    }
+    return 0;
+}
+
+// Handles `--script <file|-> | --replay <trace>`, optionally with
+// `--container array|list`. The script timing report goes to stderr so
+// stdout can be compared between runs.
+int RunCommandLine(int argc, char* argv[]) {
+    std::string script, replay;
+    ScriptOptions options;
+    bool valid = true;
+    for (int i = 1; i < argc && valid; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--script" && i + 1 < argc) script = argv[++i];
+        else if (arg == "--replay" && i + 1 < argc) replay = argv[++i];
+        else if (arg == "--container" && i + 1 < argc) {
+            std::string name = argv[++i];
+            valid = name == "array" || name == "list";
+            options.overrideContainer = true;
+            options.container = name == "list" ? Container::LIST : Container::ARRAY;
+        }
+        else valid = false;
+    }
+    if (!valid || script.empty() == replay.empty()) {
+        std::cerr << "usage: " << argv[0] << " (--script <file|-> | --replay <trace>) [--container array|list]\n";
+        return 2;
+    }
+
+    if (!replay.empty()) {
+        try {
+            return ReplayTraceFile(replay, options, std::cout);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 2;
+        }
+    }
+
+    ScriptStats stats;
+    if (script == "-") {
+        std::ios::sync_with_stdio(false);
+        stats = RunScript(std::cin, std::cout, options);
+    }
+    else {
+        std::ifstream in(script);
+        if (!in) {
+            std::cerr << "cannot open " << script << "\n";
+            return 2;
+        }
+        stats = RunScript(in, std::cout, options);
+    }
+    PrintTimings(stats, std::cerr);
+    return stats.errors == 0 ? 0 : 1;
 }
\ No newline at end of file
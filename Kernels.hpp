@@ -0,0 +1,111 @@
+#pragma once
+
+#include <type_traits>
+
+#include "SimdKernels.hpp"
+#include "DynamicArray.hpp"
+#include "ArraySequence.hpp"
+#include "error.hpp"
+
+// Aggregates over DynamicArray and MutableArraySequence storage. int and
+// double go through the vectorized Simd:: kernels; other element types use a
+// plain loop over Data(), which still avoids per-element virtual calls.
+
+namespace Kernels {
+
+    using Simd::Compare;
+
+    template <class T>
+    constexpr bool IsVectorized = std::is_same_v<T, int> || std::is_same_v<T, double>;
+
+    template <class T>
+    using SumType = std::conditional_t<std::is_integral_v<T>, long long, T>;
+
+    template <class T>
+    SumType<T> Sum(const T* data, int count) {
+        if constexpr (IsVectorized<T>) return Simd::Sum(data, count);
+        else {
+            SumType<T> sum = SumType<T>();
+            for (int i = 0; i < count; i++) sum += data[i];
+            return sum;
+        }
+    }
+
+    template <class T>
+    T Min(const T* data, int count) {
+        if (count <= 0) throw Errors::EmptyArray();
+        if constexpr (IsVectorized<T>) return Simd::Min(data, count);
+        else return Simd::Scalar::Min(data, count);
+    }
+
+    template <class T>
+    T Max(const T* data, int count) {
+        if (count <= 0) throw Errors::EmptyArray();
+        if constexpr (IsVectorized<T>) return Simd::Max(data, count);
+        else return Simd::Scalar::Max(data, count);
+    }
+
+    template <class T>
+    int CountIf(const T* data, int count, Compare op, const T& value) {
+        if constexpr (IsVectorized<T>) return Simd::CountIf(data, count, op, value);
+        else return Simd::Scalar::CountIf(data, count, op, value);
+    }
+
+    template <class T>
+    int IndexOf(const T* data, int count, const T& value) {
+        if constexpr (IsVectorized<T>) return Simd::IndexOf(data, count, value);
+        else return Simd::Scalar::IndexOf(data, count, value);
+    }
+
+    template <class T>
+    bool Equal(const T* lhs, const T* rhs, int count) {
+        if constexpr (IsVectorized<T>) return Simd::Equal(lhs, rhs, count);
+        else return Simd::Scalar::Equal(lhs, rhs, count);
+    }
+
+
+    template <class T, class Policy, int N>
+    SumType<T> Sum(const DynamicArray<T, Policy, N>& array) { return Sum(array.Data(), array.GetSize()); }
+
+    template <class T, class Policy, int N>
+    T Min(const DynamicArray<T, Policy, N>& array) { return Min(array.Data(), array.GetSize()); }
+
+    template <class T, class Policy, int N>
+    T Max(const DynamicArray<T, Policy, N>& array) { return Max(array.Data(), array.GetSize()); }
+
+    template <class T, class Policy, int N>
+    int CountIf(const DynamicArray<T, Policy, N>& array, Compare op, const T& value) {
+        return CountIf(array.Data(), array.GetSize(), op, value);
+    }
+
+    template <class T, class Policy, int N>
+    int IndexOf(const DynamicArray<T, Policy, N>& array, const T& value) {
+        return IndexOf(array.Data(), array.GetSize(), value);
+    }
+
+
+    template <class T, class Policy, class Storage>
+    SumType<T> Sum(const MutableArraySequence<T, Policy, Storage>& seq) { return Sum(seq.Data(), seq.GetLength()); }
+
+    template <class T, class Policy, class Storage>
+    T Min(const MutableArraySequence<T, Policy, Storage>& seq) { return Min(seq.Data(), seq.GetLength()); }
+
+    template <class T, class Policy, class Storage>
+    T Max(const MutableArraySequence<T, Policy, Storage>& seq) { return Max(seq.Data(), seq.GetLength()); }
+
+    template <class T, class Policy, class Storage>
+    int CountIf(const MutableArraySequence<T, Policy, Storage>& seq, Compare op, const T& value) {
+        return CountIf(seq.Data(), seq.GetLength(), op, value);
+    }
+
+    template <class T, class Policy, class Storage>
+    int IndexOf(const MutableArraySequence<T, Policy, Storage>& seq, const T& value) {
+        return IndexOf(seq.Data(), seq.GetLength(), value);
+    }
+
+    template <class T, class Policy, class Storage>
+    bool Equal(const MutableArraySequence<T, Policy, Storage>& lhs, const MutableArraySequence<T, Policy, Storage>& rhs) {
+        if (lhs.GetLength() != rhs.GetLength()) return false;
+        return Equal(lhs.Data(), rhs.Data(), lhs.GetLength());
+    }
+}
\ No newline at end of file
@@ -1,247 +1,435 @@
-#pragma once
-
-#include <stdexcept>
-
-#include "error.hpp"
-
-template <class T>
-class LinkedList {
-private:
-    struct Node {
-        T data;
-        Node* next;
-        Node(T data) : data(data), next(nullptr) {}
-        Node(T data, Node* next) : data(data), next(next) {}
-    };
-
-    Node* root;
-    Node* tail;
-    int size;
-
-public:
-    LinkedList(T* items, int count);
-    LinkedList();
-    LinkedList(const LinkedList<T>& list);
-    ~LinkedList();
-
-    T GetFirst() const;
-    T GetLast() const;
-    T Get(int index) const;
-    LinkedList<T>* GetSubList(int startIndex, int endIndex) const;
-    int GetLength() const;
-    T* GetRef(int index) const;
-
-    void Append(T item);
-    void Prepend(T item);
-    void InsertAt(T item, int index);
-    void Remove(int index);
-    LinkedList<T>* Concat(const LinkedList<T>* list);
-};
-
-template <class T>
-LinkedList<T>::LinkedList(T* items, int count) {
-    if (count < 0) throw Errors::NegativeCount();
-
-    if (count == 0) {
-        root = nullptr;
-        size = 0;
-        tail = nullptr;
-        return;
-    }
-
-    size = count;
-    root = new Node{ items[0] };
-    Node* current = root;
-
-    for (int i = 1; i < count; i++) {
-        Node* newNode = new Node{ items[i] };
-        current->next = newNode;
-        current = newNode;
-    }
-
-    tail = current;
-}
-
-template <class T>
-LinkedList<T>::LinkedList() {
-    root = nullptr;
-    size = 0;
-    tail = nullptr;
-}
-
-template <class T>
-LinkedList<T>::LinkedList(const LinkedList<T>& list) {
-    if (list.root == nullptr) {
-        root = nullptr;
-        size = 0;
-        tail = nullptr;
-        return;
-    }
-
-    root = new Node{ list.root->data };
-    Node* currentThis = root;
-    Node* currentOther = list.root->next;
-
-    while (currentOther != nullptr) {
-        currentThis->next = new Node{ currentOther->data };
-        currentThis = currentThis->next;
-        currentOther = currentOther->next;
-    }
-
-    tail = currentThis;
-    tail->next = nullptr;
-    size = list.size;
-}
-
-template <class T>
-LinkedList<T>::~LinkedList() {
-    Node* current = root;
-    while (current != nullptr) {
-        Node* temp = current;
-        current = current->next;
-        delete temp;
-    }
-}
-
-template <class T>
-T LinkedList<T>::GetFirst() const {
-    if (root == nullptr) throw Errors::EmptyList();
-
-    return root->data;
-}
-
-template <class T>
-T LinkedList<T>::GetLast() const {
-    if (root == nullptr) throw Errors::EmptyList();
-
-    return tail->data;
-}
-
-template <class T>
-T LinkedList<T>::Get(int index) const {
-    if (root == nullptr) throw Errors::EmptyList();
-
-    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
-
-    if (index == 0) return root->data;
-
-    Node* current = root;
-
-    for (int i = 0; i < index; i++) {
-
-        current = current->next;
-    }
-
-    return current->data;
-}
-
-template <class T>
-LinkedList<T>* LinkedList<T>::GetSubList(int startIndex, int endIndex) const {
-    if (startIndex < 0 || endIndex >= size || startIndex > endIndex) throw Errors::InvalidIndices();
-
-    LinkedList<T>* sublist = new LinkedList<T>();
-    Node* current = root;
-
-    for (int i = 0; i < startIndex; i++) {
-        current = current->next;
-    }
-
-    sublist->Append(current->data);
-
-    for (int i = startIndex + 1; i <= endIndex; i++) {
-        current = current->next;
-        sublist->Append(current->data);
-    }
-
-    return sublist;
-}
-
-template <class T>
-int LinkedList<T>::GetLength() const {
-
-    return size;
-}
-
-template <class T>
-T* LinkedList<T>::GetRef(int index) const {
-    T temp = Get(index);
-    return &temp;
-}
-
-template <class T>
-void LinkedList<T>::Append(T item) {
-
-    Node* newNode = new Node{ item };
-    if (root == nullptr) root = newNode;
-
-    else tail->next = newNode;
-
-    tail = newNode;
-    size++;
-}
-
-template <class T>
-void LinkedList<T>::Prepend(T item) {
-    Node* newNode = new Node{ item, root };
-    root = newNode;
-    size++;
-}
-
-template <class T>
-void LinkedList<T>::InsertAt(T item, int index) {
-    if (index > size || index < 0) throw Errors::IndexOutOfRange();
-
-    Node* current = root;
-    Node* newNode = new Node{ item };
-
-    if (index == 0) {
-        newNode->next = root;
-        root = newNode;
-    }
-    else {
-        for (int i = 0; i < index - 1; i++) {
-            current = current->next;
-        }
-        Node* temp = current->next;
-        current->next = newNode;
-        newNode->next = temp;
-    }
-    size++;
-}
-
-template <class T>
-void LinkedList<T>::Remove(int index) {
-    if (size == 0) throw Errors::EmptyList();
-
-    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
-
-    Node* current = root;
-    Node* temp;
-
-    if (index == 0) {
-        root = current->next;
-        delete(current);
-    }
-    else {
-        for (int i = 0; i < index - 1; i++) {
-            current = current->next;
-        }
-        temp = current->next;
-        current->next = temp->next;
-        delete(temp);
-    }
-    size--;
-}
-
-template <class T>
-LinkedList<T>* LinkedList<T>::Concat(const LinkedList<T>* list) {
-
-    if (list == nullptr) throw Errors::NullList();
-
-    LinkedList<T>* result = new LinkedList<T>(*this);
-    result->tail->next = list->root;
-
-    result->size += list->size;
-    result->tail = list->tail;
-    return result;
+#pragma once
+
+#include <functional>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "error.hpp"
+#include "Result.hpp"
+#include "BoundsPolicy.hpp"
+
+// Nodes come from a std::pmr::memory_resource, the default resource unless
+// one is passed in. Copies and lists built from this one (GetSubList, Concat)
+// use the default resource, like std::pmr containers, so they can outlive an
+// arena the original lives in.
+template <class T, class Policy = Checked>
+class LinkedList {
+private:
+    struct Node {
+        T data;
+        Node* next;
+        Node(const T& data, Node* next) : data(data), next(next) {}
+    };
+
+    Node* root;
+    Node* tail;
+    int size;
+    std::pmr::memory_resource* resource;
+
+    Node* NodeAt(int index) const;
+    Node* NewNode(const T& item, Node* next);
+    void DeleteNode(Node* node);
+    void Clear();
+
+public:
+    LinkedList(T* items, int count, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    explicit LinkedList(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    LinkedList(const LinkedList<T, Policy>& list);
+    LinkedList(LinkedList<T, Policy>&& list) noexcept;
+    ~LinkedList();
+
+    LinkedList<T, Policy>& operator=(const LinkedList<T, Policy>& list);
+    LinkedList<T, Policy>& operator=(LinkedList<T, Policy>&& list);
+
+    std::pmr::memory_resource* GetResource() const { return resource; }
+
+    T GetFirst() const;
+    T GetLast() const;
+    T Get(int index) const;
+    Result<T> TryGetFirst() const;
+    Result<T> TryGetLast() const;
+    Result<T> TryGet(int index) const;
+    LinkedList<T, Policy>* GetSubList(int startIndex, int endIndex) const;
+    int GetLength() const;
+    T* GetRef(int index) const;
+    T& At(int index);
+    const T& At(int index) const;
+
+    void Append(T item);
+    void Prepend(T item);
+    void InsertAt(T item, int index);
+    void Remove(int index);
+    LinkedList<T, Policy>* Concat(const LinkedList<T, Policy>* list) const;
+
+    template <class F>
+    void ForEach(F visit) const;
+    template <class F>
+    bool ForEachWhile(F visit) const;
+
+    template <class Compare = std::less<T>>
+    void Sort(Compare cmp = Compare());
+};
+
+template <class T, class Policy>
+typename LinkedList<T, Policy>::Node* LinkedList<T, Policy>::NewNode(const T& item, Node* next) {
+    void* memory = resource->allocate(sizeof(Node), alignof(Node));
+    try {
+        return new (memory) Node(item, next);
+    }
+    catch (...) {
+        resource->deallocate(memory, sizeof(Node), alignof(Node));
+        throw;
+    }
+}
+
+template <class T, class Policy>
+void LinkedList<T, Policy>::DeleteNode(Node* node) {
+    node->~Node();
+    resource->deallocate(node, sizeof(Node), alignof(Node));
+}
+
+template <class T, class Policy>
+void LinkedList<T, Policy>::Clear() {
+    Node* current = root;
+    while (current != nullptr) {
+        Node* temp = current;
+        current = current->next;
+        DeleteNode(temp);
+    }
+    root = nullptr;
+    tail = nullptr;
+    size = 0;
+}
+
+template <class T, class Policy>
+LinkedList<T, Policy>::LinkedList(T* items, int count, std::pmr::memory_resource* resource)
+    : root(nullptr), tail(nullptr), size(0), resource(resource) {
+    if (count < 0) throw Errors::NegativeCount();
+
+    try {
+        for (int i = 0; i < count; i++) Append(items[i]);
+    }
+    catch (...) {
+        Clear();
+        throw;
+    }
+}
+
+template <class T, class Policy>
+LinkedList<T, Policy>::LinkedList(std::pmr::memory_resource* resource)
+    : root(nullptr), tail(nullptr), size(0), resource(resource) {}
+
+template <class T, class Policy>
+LinkedList<T, Policy>::LinkedList(const LinkedList<T, Policy>& list)
+    : root(nullptr), tail(nullptr), size(0), resource(std::pmr::get_default_resource()) {
+    try {
+        list.ForEach([this](const T& item) { Append(item); });
+    }
+    catch (...) {
+        Clear();
+        throw;
+    }
+}
+
+template <class T, class Policy>
+LinkedList<T, Policy>::LinkedList(LinkedList<T, Policy>&& list) noexcept
+    : root(list.root), tail(list.tail), size(list.size), resource(list.resource) {
+    list.root = nullptr;
+    list.tail = nullptr;
+    list.size = 0;
+}
+
+template <class T, class Policy>
+LinkedList<T, Policy>::~LinkedList() {
+    Clear();
+}
+
+// Assignment keeps this list's resource.
+template <class T, class Policy>
+LinkedList<T, Policy>& LinkedList<T, Policy>::operator=(const LinkedList<T, Policy>& list) {
+    if (this == &list) return *this;
+
+    LinkedList<T, Policy> copy(resource);
+    list.ForEach([&copy](const T& item) { copy.Append(item); });
+    return *this = std::move(copy);
+}
+
+template <class T, class Policy>
+LinkedList<T, Policy>& LinkedList<T, Policy>::operator=(LinkedList<T, Policy>&& list) {
+    if (this == &list) return *this;
+    if (!resource->is_equal(*list.resource)) {
+        *this = static_cast<const LinkedList<T, Policy>&>(list);
+        list.Clear();
+        return *this;
+    }
+
+    Clear();
+    root = list.root;
+    tail = list.tail;
+    size = list.size;
+    list.root = nullptr;
+    list.tail = nullptr;
+    list.size = 0;
+    return *this;
+}
+
+template <class T, class Policy>
+T LinkedList<T, Policy>::GetFirst() const {
+    Policy::Require(root != nullptr, ErrorCode::EMPTY_LIST);
+
+    return root->data;
+}
+
+template <class T, class Policy>
+T LinkedList<T, Policy>::GetLast() const {
+    Policy::Require(root != nullptr, ErrorCode::EMPTY_LIST);
+
+    return tail->data;
+}
+
+template <class T, class Policy>
+typename LinkedList<T, Policy>::Node* LinkedList<T, Policy>::NodeAt(int index) const {
+    Policy::Require(root != nullptr, ErrorCode::EMPTY_LIST);
+
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    if (index == size - 1) return tail;
+
+    Node* current = root;
+
+    for (int i = 0; i < index; i++) {
+
+        current = current->next;
+    }
+
+    return current;
+}
+
+template <class T, class Policy>
+T LinkedList<T, Policy>::Get(int index) const {
+
+    return NodeAt(index)->data;
+}
+
+template <class T, class Policy>
+Result<T> LinkedList<T, Policy>::TryGetFirst() const {
+    if (root == nullptr) return ErrorCode::EMPTY_LIST;
+
+    return root->data;
+}
+
+template <class T, class Policy>
+Result<T> LinkedList<T, Policy>::TryGetLast() const {
+    if (root == nullptr) return ErrorCode::EMPTY_LIST;
+
+    return tail->data;
+}
+
+template <class T, class Policy>
+Result<T> LinkedList<T, Policy>::TryGet(int index) const {
+    if (root == nullptr) return ErrorCode::EMPTY_LIST;
+
+    if (index < 0 || index >= size) return ErrorCode::INDEX_OUT_OF_RANGE;
+
+    Node* current = root;
+
+    for (int i = 0; i < index; i++) {
+
+        current = current->next;
+    }
+
+    return current->data;
+}
+
+template <class T, class Policy>
+LinkedList<T, Policy>* LinkedList<T, Policy>::GetSubList(int startIndex, int endIndex) const {
+    Policy::Require(startIndex >= 0 && endIndex < size && startIndex <= endIndex, ErrorCode::INVALID_INDICES);
+
+    LinkedList<T, Policy>* sublist = new LinkedList<T, Policy>();
+    Node* current = root;
+
+    for (int i = 0; i < startIndex; i++) {
+        current = current->next;
+    }
+
+    sublist->Append(current->data);
+
+    for (int i = startIndex + 1; i <= endIndex; i++) {
+        current = current->next;
+        sublist->Append(current->data);
+    }
+
+    return sublist;
+}
+
+template <class T, class Policy>
+int LinkedList<T, Policy>::GetLength() const {
+
+    return size;
+}
+
+template <class T, class Policy>
+T* LinkedList<T, Policy>::GetRef(int index) const {
+
+    return &NodeAt(index)->data;
+}
+
+template <class T, class Policy>
+T& LinkedList<T, Policy>::At(int index) {
+
+    return NodeAt(index)->data;
+}
+
+template <class T, class Policy>
+const T& LinkedList<T, Policy>::At(int index) const {
+
+    return NodeAt(index)->data;
+}
+
+template <class T, class Policy>
+void LinkedList<T, Policy>::Append(T item) {
+
+    Node* newNode = NewNode(item, nullptr);
+    if (root == nullptr) root = newNode;
+
+    else tail->next = newNode;
+
+    tail = newNode;
+    size++;
+}
+
+template <class T, class Policy>
+void LinkedList<T, Policy>::Prepend(T item) {
+    Node* newNode = NewNode(item, root);
+    root = newNode;
+    if (tail == nullptr) tail = newNode;
+    size++;
+}
+
+template <class T, class Policy>
+void LinkedList<T, Policy>::InsertAt(T item, int index) {
+    Policy::Require(index >= 0 && index <= size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    Node* current = root;
+    Node* newNode = NewNode(item, nullptr);
+
+    if (index == 0) {
+        newNode->next = root;
+        root = newNode;
+    }
+    else {
+        for (int i = 0; i < index - 1; i++) {
+            current = current->next;
+        }
+        Node* temp = current->next;
+        current->next = newNode;
+        newNode->next = temp;
+    }
+    if (newNode->next == nullptr) tail = newNode;
+    size++;
+}
+
+template <class T, class Policy>
+void LinkedList<T, Policy>::Remove(int index) {
+    Policy::Require(size != 0, ErrorCode::EMPTY_LIST);
+
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    Node* current = root;
+    Node* temp;
+
+    if (index == 0) {
+        root = current->next;
+        if (root == nullptr) tail = nullptr;
+        DeleteNode(current);
+    }
+    else {
+        for (int i = 0; i < index - 1; i++) {
+            current = current->next;
+        }
+        temp = current->next;
+        current->next = temp->next;
+        if (temp == tail) tail = current;
+        DeleteNode(temp);
+    }
+    size--;
+}
+
+template <class T, class Policy>
+LinkedList<T, Policy>* LinkedList<T, Policy>::Concat(const LinkedList<T, Policy>* list) const {
+
+    if (list == nullptr) throw Errors::NullList();
+
+    LinkedList<T, Policy>* result = new LinkedList<T, Policy>(*this);
+    list->ForEach([result](const T& item) { result->Append(item); });
+    return result;
+}
+
+template <class T, class Policy>
+template <class F>
+void LinkedList<T, Policy>::ForEach(F visit) const {
+    for (Node* current = root; current != nullptr; current = current->next)
+        visit(current->data);
+}
+
+// Visits items until visit returns false; returns false if it stopped early.
+template <class T, class Policy>
+template <class F>
+bool LinkedList<T, Policy>::ForEachWhile(F visit) const {
+    for (Node* current = root; current != nullptr; current = current->next)
+        if (!visit(current->data)) return false;
+    return true;
+}
+
+// Stable bottom-up merge sort. Nodes are relinked in place, so payloads are
+// never copied and references into the list stay valid.
+template <class T, class Policy>
+template <class Compare>
+void LinkedList<T, Policy>::Sort(Compare cmp) {
+    if (size < 2) return;
+
+    for (int width = 1; ; width *= 2) {
+        Node* left = root;
+        Node* last = nullptr;
+        int merges = 0;
+        root = nullptr;
+
+        while (left != nullptr) {
+            merges++;
+            Node* right = left;
+            int leftCount = 0;
+            for (; leftCount < width && right != nullptr; leftCount++) right = right->next;
+            int rightCount = width;
+
+            while (leftCount > 0 || (rightCount > 0 && right != nullptr)) {
+                Node* next;
+                if (leftCount == 0) {
+                    next = right;
+                    right = right->next;
+                    rightCount--;
+                }
+                else if (rightCount == 0 || right == nullptr || !cmp(right->data, left->data)) {
+                    next = left;
+                    left = left->next;
+                    leftCount--;
+                }
+                else {
+                    next = right;
+                    right = right->next;
+                    rightCount--;
+                }
+
+                if (last != nullptr) last->next = next;
+                else root = next;
+                last = next;
+            }
+            left = right;
+        }
+
+        last->next = nullptr;
+        tail = last;
+        if (merges <= 1) return;
+    }
 }
\ No newline at end of file
@@ -1,220 +1,308 @@
-#pragma once
-
-#include "Sequence.hpp"
-#include "LinkedList.hpp"
-#include "error.hpp"
-#include <stdexcept>
-
-template <typename T>
-class MutableListSequence : public Sequence<T> {
-protected:
-    int size;
-
-    LinkedList<T>* list;
-
-    Sequence<T>* CreateFromList(LinkedList<T>* list) const;
-
-public:
-    MutableListSequence();
-    MutableListSequence(T* items, int count);
-    MutableListSequence(const MutableListSequence<T>& other);
-    MutableListSequence(const LinkedList<T>& list);
-    ~MutableListSequence() override;
-
-    T GetFirst() const override;
-    T GetLast() const override;
-    T Get(int index) const override;
-    int GetLength() const override;
-    T* GetRef(int index) const;
-
-    Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
-    Sequence<T>* Concat(const Sequence<T>* other) const override;
-
-    Sequence<T>* Append(T item) override;
-    Sequence<T>* Prepend(T item) override;
-    Sequence<T>* InsertAt(T item, int index) override;
-    Sequence<T>* Remove(int index) override;
-
-    Sequence<T>* Instance() override;
-    Sequence<T>* Clone() const override;
-};
-
-
-template <typename T>
-MutableListSequence<T>::MutableListSequence() {
-    list = new LinkedList<T>();
-    size = 0;
-}
-
-template <typename T>
-MutableListSequence<T>::MutableListSequence(T* items, int count) {
-    list = new LinkedList<T>(items, count);
-    size = count;
-}
-
-template <typename T>
-MutableListSequence<T>::MutableListSequence(const MutableListSequence<T>& other) {
-    list = new LinkedList<T>(*other.list);
-    size = other.size;
-}
-
-template <typename T>
-MutableListSequence<T>::MutableListSequence(const LinkedList<T>& list) {
-    this->list = new LinkedList<T>(list);
-    size = list.GetLength();
-}
-
-template <typename T>
-MutableListSequence<T>::~MutableListSequence() {
-    delete list;
-}
-
-template <typename T>
-T MutableListSequence<T>::GetFirst() const {
-    return list->GetFirst();
-}
-
-template <typename T>
-T MutableListSequence<T>::GetLast() const {
-    int i = 0;
-    for (; i < size - 1; i++) {}
-    return list->Get(i);
-}
-
-template <typename T>
-T MutableListSequence<T>::Get(int index) const {
-    return list->Get(index);
-}
-
-template <typename T>
-int MutableListSequence<T>::GetLength() const {
-    return list->GetLength();
-}
-
-template <typename T>
-Sequence<T>* MutableListSequence<T>::GetSubsequence(int startIndex, int endIndex) const {
-    LinkedList<T>* sub = list->GetSubList(startIndex, endIndex);
-    auto* result = new MutableListSequence<T>(*sub);
-    delete sub;
-    return result;
-}
-
-template <typename T>
-T* MutableListSequence<T>::GetRef(int index) const {
-    return list->GetRef(index);
-}
-
-template <typename T>
-Sequence<T>* MutableListSequence<T>::Concat(const Sequence<T>* other) const {
-    auto otherList = dynamic_cast<const MutableListSequence<T>*>(other);
-    if (!otherList) throw Errors::IncompatibleTypes();
-    LinkedList<T>* result = list->Concat(otherList->list);
-    return CreateFromList(result);
-}
-
-template <typename T>
-Sequence<T>* MutableListSequence<T>::Append(T item) {
-    list->Append(item);
-    size++;
-    return this;
-}
-
-template <typename T>
-Sequence<T>* MutableListSequence<T>::Prepend(T item) {
-    list->Prepend(item);
-    size++;
-    return this;
-}
-
-template <typename T>
-Sequence<T>* MutableListSequence<T>::InsertAt(T item, int index) {
-    list->InsertAt(item, index);
-    return this;
-}
-
-template <typename T>
-Sequence<T>* MutableListSequence<T>::Remove(int index) {
-    if (list->GetLength() == 0) throw Errors::EmptyList();
-    list->Remove(index);
-    size--;
-    return this;
-}
-
-template <typename T>
-Sequence<T>* MutableListSequence<T>::Instance() {
-    return this;
-}
-
-template <typename T>
-Sequence<T>* MutableListSequence<T>::Clone() const {
-    return new MutableListSequence<T>(*this);
-}
-
-template <typename T>
-Sequence<T>* MutableListSequence<T>::CreateFromList(LinkedList<T>* list) const {
-    return new MutableListSequence<T>(*list);
-}
-
-template <typename T>
-MutableListSequence<T> operator+(const MutableListSequence<T>& lhs, const MutableListSequence<T>& rhs) {
-    Sequence<T>* resultBase = lhs.Concat(&rhs);
-    auto* result = static_cast<MutableListSequence<T>*>(resultBase);
-    MutableListSequence<T> copy(*result);
-    delete result;
-    return copy;
-}
-
-
-template <typename T>
-class ImmutableListSequence : public MutableListSequence<T> {
-public:
-    using MutableListSequence<T>::MutableListSequence;
-
-    Sequence<T>* Append(T item) override;
-    Sequence<T>* Prepend(T item) override;
-    Sequence<T>* InsertAt(T item, int index) override;
-    Sequence<T>* Remove(int index) override;
-
-    Sequence<T>* Instance() override;
-    Sequence<T>* Clone() const override;
-};
-
-
-template <typename T>
-Sequence<T>* ImmutableListSequence<T>::Append(T item) {
-    return this->Clone()->Append(item);
-}
-
-template <typename T>
-Sequence<T>* ImmutableListSequence<T>::Prepend(T item) {
-    return this->Clone()->Prepend(item);
-}
-
-template <typename T>
-Sequence<T>* ImmutableListSequence<T>::InsertAt(T item, int index) {
-    return this->Clone()->InsertAt(item, index);
-}
-
-template <typename T>
-Sequence<T>* ImmutableListSequence<T>::Remove(int index) {
-    return this->Clone()->Remove(index);
-}
-
-template <typename T>
-Sequence<T>* ImmutableListSequence<T>::Instance() {
-    return this->Clone();
-}
-
-template <typename T>
-Sequence<T>* ImmutableListSequence<T>::Clone() const {
-    return new ImmutableListSequence<T>(*this);
-}
-
-template <typename T>
-ImmutableListSequence<T> operator+(const ImmutableListSequence<T>& lhs, const ImmutableListSequence<T>& rhs) {
-    Sequence<T>* resultBase = lhs.Concat(&rhs);
-    auto* result = static_cast<ImmutableListSequence<T>*>(resultBase);
-    ImmutableListSequence<T> copy(*result);
-    delete result;
-    return copy;
+#pragma once
+
+#include "Sequence.hpp"
+#include "LinkedList.hpp"
+#include "error.hpp"
+#include <functional>
+#include <memory_resource>
+#include <utility>
+#include <stdexcept>
+
+template <typename T, class Policy = Checked>
+class MutableListSequence : public Sequence<T> {
+protected:
+    int size;
+
+    LinkedList<T, Policy> list;
+
+    Sequence<T>* CreateFromList(LinkedList<T, Policy>&& list) const;
+
+public:
+    MutableListSequence();
+    explicit MutableListSequence(std::pmr::memory_resource* resource);
+    MutableListSequence(T* items, int count, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    MutableListSequence(const MutableListSequence<T, Policy>& other);
+    MutableListSequence(MutableListSequence<T, Policy>&& other) noexcept;
+    MutableListSequence(const LinkedList<T, Policy>& list);
+    MutableListSequence(LinkedList<T, Policy>&& list) noexcept;
+    ~MutableListSequence() override;
+
+    MutableListSequence<T, Policy>& operator=(const MutableListSequence<T, Policy>& other);
+    MutableListSequence<T, Policy>& operator=(MutableListSequence<T, Policy>&& other);
+
+    T GetFirst() const override;
+    T GetLast() const override;
+    T Get(int index) const override;
+    Result<T> TryGetFirst() const override;
+    Result<T> TryGetLast() const override;
+    Result<T> TryGet(int index) const override;
+    int GetLength() const override;
+    T* GetRef(int index) const;
+    T& At(int index);
+    const T& At(int index) const override;
+    std::pmr::memory_resource* GetResource() const { return list.GetResource(); }
+
+    Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
+    Sequence<T>* Concat(const Sequence<T>* other) const override;
+
+    Sequence<T>* Append(T item) override;
+    Sequence<T>* Prepend(T item) override;
+    Sequence<T>* InsertAt(T item, int index) override;
+    Sequence<T>* Remove(int index) override;
+
+    Sequence<T>* Instance() override;
+    Sequence<T>* Clone() const override;
+
+    template <class F>
+    void ForEach(F visit) const;
+    template <class F>
+    bool ForEachWhile(F visit) const;
+
+    template <class Compare = std::less<T>>
+    void Sort(Compare cmp = Compare());
+};
+
+
+template <typename T, class Policy>
+MutableListSequence<T, Policy>::MutableListSequence() : size(0), list() {}
+
+template <typename T, class Policy>
+MutableListSequence<T, Policy>::MutableListSequence(std::pmr::memory_resource* resource) : size(0), list(resource) {}
+
+template <typename T, class Policy>
+MutableListSequence<T, Policy>::MutableListSequence(T* items, int count, std::pmr::memory_resource* resource)
+    : size(count), list(items, count, resource) {}
+
+template <typename T, class Policy>
+MutableListSequence<T, Policy>::MutableListSequence(const MutableListSequence<T, Policy>& other) : size(other.size), list(other.list) {}
+
+template <typename T, class Policy>
+MutableListSequence<T, Policy>::MutableListSequence(MutableListSequence<T, Policy>&& other) noexcept
+    : size(other.size), list(std::move(other.list)) {
+    other.size = 0;
+}
+
+template <typename T, class Policy>
+MutableListSequence<T, Policy>::MutableListSequence(const LinkedList<T, Policy>& list) : size(list.GetLength()), list(list) {}
+
+template <typename T, class Policy>
+MutableListSequence<T, Policy>::MutableListSequence(LinkedList<T, Policy>&& list) noexcept
+    : size(list.GetLength()), list(std::move(list)) {}
+
+template <typename T, class Policy>
+MutableListSequence<T, Policy>& MutableListSequence<T, Policy>::operator=(const MutableListSequence<T, Policy>& other) {
+    list = other.list;
+    size = other.size;
+    return *this;
+}
+
+template <typename T, class Policy>
+MutableListSequence<T, Policy>& MutableListSequence<T, Policy>::operator=(MutableListSequence<T, Policy>&& other) {
+    if (this == &other) return *this;
+    list = std::move(other.list);
+    size = other.size;
+    other.size = 0;
+    return *this;
+}
+
+template <typename T, class Policy>
+MutableListSequence<T, Policy>::~MutableListSequence() = default;
+
+template <typename T, class Policy>
+T MutableListSequence<T, Policy>::GetFirst() const {
+    return list.GetFirst();
+}
+
+template <typename T, class Policy>
+T MutableListSequence<T, Policy>::GetLast() const {
+    return list.GetLast();
+}
+
+template <typename T, class Policy>
+T MutableListSequence<T, Policy>::Get(int index) const {
+    return list.Get(index);
+}
+
+template <typename T, class Policy>
+Result<T> MutableListSequence<T, Policy>::TryGetFirst() const {
+    return list.TryGetFirst();
+}
+
+template <typename T, class Policy>
+Result<T> MutableListSequence<T, Policy>::TryGetLast() const {
+    return list.TryGetLast();
+}
+
+template <typename T, class Policy>
+Result<T> MutableListSequence<T, Policy>::TryGet(int index) const {
+    return list.TryGet(index);
+}
+
+template <typename T, class Policy>
+int MutableListSequence<T, Policy>::GetLength() const {
+    return list.GetLength();
+}
+
+template <typename T, class Policy>
+Sequence<T>* MutableListSequence<T, Policy>::GetSubsequence(int startIndex, int endIndex) const {
+    LinkedList<T, Policy>* sub = list.GetSubList(startIndex, endIndex);
+    auto* result = new MutableListSequence<T, Policy>(std::move(*sub));
+    delete sub;
+    return result;
+}
+
+template <typename T, class Policy>
+T* MutableListSequence<T, Policy>::GetRef(int index) const {
+    return list.GetRef(index);
+}
+
+template <typename T, class Policy>
+T& MutableListSequence<T, Policy>::At(int index) {
+    return list.At(index);
+}
+
+template <typename T, class Policy>
+const T& MutableListSequence<T, Policy>::At(int index) const {
+    return list.At(index);
+}
+
+template <typename T, class Policy>
+Sequence<T>* MutableListSequence<T, Policy>::Concat(const Sequence<T>* other) const {
+    auto otherList = dynamic_cast<const MutableListSequence<T, Policy>*>(other);
+    if (!otherList) throw Errors::IncompatibleTypes();
+    LinkedList<T, Policy>* result = list.Concat(&otherList->list);
+    Sequence<T>* sequence = CreateFromList(std::move(*result));
+    delete result;
+    return sequence;
+}
+
+template <typename T, class Policy>
+Sequence<T>* MutableListSequence<T, Policy>::Append(T item) {
+    list.Append(item);
+    size++;
+    return this;
+}
+
+template <typename T, class Policy>
+Sequence<T>* MutableListSequence<T, Policy>::Prepend(T item) {
+    list.Prepend(item);
+    size++;
+    return this;
+}
+
+template <typename T, class Policy>
+Sequence<T>* MutableListSequence<T, Policy>::InsertAt(T item, int index) {
+    list.InsertAt(item, index);
+    size++;
+    return this;
+}
+
+template <typename T, class Policy>
+Sequence<T>* MutableListSequence<T, Policy>::Remove(int index) {
+    Policy::Require(list.GetLength() != 0, ErrorCode::EMPTY_LIST);
+    list.Remove(index);
+    size--;
+    return this;
+}
+
+template <typename T, class Policy>
+Sequence<T>* MutableListSequence<T, Policy>::Instance() {
+    return this;
+}
+
+template <typename T, class Policy>
+Sequence<T>* MutableListSequence<T, Policy>::Clone() const {
+    return new MutableListSequence<T, Policy>(*this);
+}
+
+template <typename T, class Policy>
+Sequence<T>* MutableListSequence<T, Policy>::CreateFromList(LinkedList<T, Policy>&& list) const {
+    return new MutableListSequence<T, Policy>(std::move(list));
+}
+
+template <typename T, class Policy>
+template <class F>
+void MutableListSequence<T, Policy>::ForEach(F visit) const {
+    list.ForEach(visit);
+}
+
+template <typename T, class Policy>
+template <class F>
+bool MutableListSequence<T, Policy>::ForEachWhile(F visit) const {
+    return list.ForEachWhile(visit);
+}
+
+template <typename T, class Policy>
+template <class Compare>
+void MutableListSequence<T, Policy>::Sort(Compare cmp) {
+    list.Sort(cmp);
+}
+
+template <typename T, class Policy>
+MutableListSequence<T, Policy> operator+(const MutableListSequence<T, Policy>& lhs, const MutableListSequence<T, Policy>& rhs) {
+    Sequence<T>* resultBase = lhs.Concat(&rhs);
+    auto* result = static_cast<MutableListSequence<T, Policy>*>(resultBase);
+    MutableListSequence<T, Policy> copy(*result);
+    delete result;
+    return copy;
+}
+
+
+template <typename T, class Policy = Checked>
+class ImmutableListSequence : public MutableListSequence<T, Policy> {
+public:
+    using MutableListSequence<T, Policy>::MutableListSequence;
+    using MutableListSequence<T, Policy>::At;
+
+    T& At(int index) = delete;
+    template <class Compare = std::less<T>>
+    void Sort(Compare cmp = Compare()) = delete;
+
+    Sequence<T>* Append(T item) override;
+    Sequence<T>* Prepend(T item) override;
+    Sequence<T>* InsertAt(T item, int index) override;
+    Sequence<T>* Remove(int index) override;
+
+    Sequence<T>* Instance() override;
+    Sequence<T>* Clone() const override;
+};
+
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableListSequence<T, Policy>::Append(T item) {
+    return this->Clone()->Append(item);
+}
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableListSequence<T, Policy>::Prepend(T item) {
+    return this->Clone()->Prepend(item);
+}
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableListSequence<T, Policy>::InsertAt(T item, int index) {
+    return this->Clone()->InsertAt(item, index);
+}
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableListSequence<T, Policy>::Remove(int index) {
+    return this->Clone()->Remove(index);
+}
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableListSequence<T, Policy>::Instance() {
+    return this->Clone();
+}
+
+template <typename T, class Policy>
+Sequence<T>* ImmutableListSequence<T, Policy>::Clone() const {
+    return new ImmutableListSequence<T, Policy>(*this);
+}
+
+template <typename T, class Policy>
+ImmutableListSequence<T, Policy> operator+(const ImmutableListSequence<T, Policy>& lhs, const ImmutableListSequence<T, Policy>& rhs) {
+    Sequence<T>* resultBase = lhs.Concat(&rhs);
+    auto* result = static_cast<ImmutableListSequence<T, Policy>*>(resultBase);
+    ImmutableListSequence<T, Policy> copy(*result);
+    delete result;
+    return copy;
 }
\ No newline at end of file
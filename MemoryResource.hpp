@@ -0,0 +1,243 @@
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+
+// Memory resources for the containers' std::pmr::memory_resource parameter.
+//
+// ArenaResource hands out memory by bumping a pointer through blocks taken
+// from upstream and ignores deallocate; Release() (or the destructor) frees
+// everything at once, so a per-request arena can drop whole containers
+// without per-node frees. PoolResource keeps a free list per power-of-two
+// size class up to MaxPooled bytes and carves them from upstream slabs, which
+// suits list nodes that are freed and reused. CountingResource forwards to
+// its upstream and keeps the bytes in use and their peak, for measuring how
+// much a container really holds. None of them is thread-safe.
+
+class ArenaResource : public std::pmr::memory_resource {
+private:
+    struct Block {
+        Block* next;
+        std::size_t bytes;
+    };
+
+    std::pmr::memory_resource* upstream;
+    Block* blocks;
+    char* current;
+    char* end;
+    std::size_t initialBlockSize;
+    std::size_t nextBlockSize;
+    std::size_t used;
+
+    void Grow(std::size_t bytes, std::size_t alignment);
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+public:
+    explicit ArenaResource(std::size_t initialBlockSize = 4096, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+    // Serves from buffer first, e.g. a stack array; buffer is never freed.
+    ArenaResource(void* buffer, std::size_t size, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+    ArenaResource(const ArenaResource&) = delete;
+    ArenaResource& operator=(const ArenaResource&) = delete;
+    ~ArenaResource() override { Release(); }
+
+    void Release();
+    std::size_t GetBytesUsed() const { return used; }
+};
+
+inline ArenaResource::ArenaResource(std::size_t initialBlockSize, std::pmr::memory_resource* upstream)
+    : upstream(upstream), blocks(nullptr), current(nullptr), end(nullptr),
+      initialBlockSize(initialBlockSize < 64 ? 64 : initialBlockSize), nextBlockSize(this->initialBlockSize), used(0) {}
+
+inline ArenaResource::ArenaResource(void* buffer, std::size_t size, std::pmr::memory_resource* upstream)
+    : upstream(upstream), blocks(nullptr), current(static_cast<char*>(buffer)), end(static_cast<char*>(buffer) + size),
+      initialBlockSize(size < 64 ? 64 : size), nextBlockSize(initialBlockSize), used(0) {}
+
+inline void ArenaResource::Grow(std::size_t bytes, std::size_t alignment) {
+    std::size_t needed = sizeof(Block) + bytes + alignment;
+    std::size_t blockSize = nextBlockSize;
+    while (blockSize < needed) blockSize *= 2;
+    nextBlockSize = blockSize * 2;
+
+    Block* block = static_cast<Block*>(upstream->allocate(blockSize, alignof(std::max_align_t)));
+    block->next = blocks;
+    block->bytes = blockSize;
+    blocks = block;
+    current = reinterpret_cast<char*>(block + 1);
+    end = reinterpret_cast<char*>(block) + blockSize;
+}
+
+inline void* ArenaResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    auto address = reinterpret_cast<std::uintptr_t>(current);
+    std::size_t padding = (alignment - address % alignment) % alignment;
+    if (current == nullptr || padding + bytes > std::size_t(end - current)) {
+        Grow(bytes, alignment);
+        address = reinterpret_cast<std::uintptr_t>(current);
+        padding = (alignment - address % alignment) % alignment;
+    }
+
+    char* result = current + padding;
+    current = result + bytes;
+    used += bytes;
+    return result;
+}
+
+// Frees every block taken from upstream. An initial buffer is not reused.
+inline void ArenaResource::Release() {
+    while (blocks != nullptr) {
+        Block* next = blocks->next;
+        upstream->deallocate(blocks, blocks->bytes, alignof(std::max_align_t));
+        blocks = next;
+    }
+    current = nullptr;
+    end = nullptr;
+    nextBlockSize = initialBlockSize;
+    used = 0;
+}
+
+
+class PoolResource : public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t MinPooled = 16;
+    static constexpr std::size_t MaxPooled = 1024;
+
+private:
+    static constexpr int ClassCount = 7;
+    static constexpr std::size_t SlabSize = 64 * 1024;
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct alignas(std::max_align_t) Slab {
+        Slab* next;
+    };
+
+    std::pmr::memory_resource* upstream;
+    FreeBlock* freeLists[ClassCount];
+    Slab* slabs;
+    char* current;
+    char* end;
+
+    static int ClassOf(std::size_t bytes);
+    static std::size_t ClassSize(int sizeClass) { return MinPooled << sizeClass; }
+    static bool Pooled(std::size_t bytes, std::size_t alignment) {
+        return bytes <= MaxPooled && alignment <= alignof(std::max_align_t);
+    }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* block, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+public:
+    explicit PoolResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+    PoolResource(const PoolResource&) = delete;
+    PoolResource& operator=(const PoolResource&) = delete;
+    ~PoolResource() override { Release(); }
+
+    // Frees all slabs. Blocks larger than MaxPooled go straight to upstream
+    // and must still be deallocated one by one.
+    void Release();
+};
+
+inline PoolResource::PoolResource(std::pmr::memory_resource* upstream)
+    : upstream(upstream), freeLists(), slabs(nullptr), current(nullptr), end(nullptr) {}
+
+inline int PoolResource::ClassOf(std::size_t bytes) {
+    int sizeClass = 0;
+    while (ClassSize(sizeClass) < bytes) sizeClass++;
+    return sizeClass;
+}
+
+inline void* PoolResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    if (!Pooled(bytes, alignment)) return upstream->allocate(bytes, alignment);
+
+    int sizeClass = ClassOf(bytes);
+    if (FreeBlock* block = freeLists[sizeClass]) {
+        freeLists[sizeClass] = block->next;
+        return block;
+    }
+
+    // Class sizes are multiples of 16 and slabs start max-aligned, so every
+    // carved block is max-aligned.
+    std::size_t size = ClassSize(sizeClass);
+    if (current == nullptr || size > std::size_t(end - current)) {
+        Slab* slab = static_cast<Slab*>(upstream->allocate(SlabSize, alignof(std::max_align_t)));
+        slab->next = slabs;
+        slabs = slab;
+        current = reinterpret_cast<char*>(slab + 1);
+        end = reinterpret_cast<char*>(slab) + SlabSize;
+    }
+
+    void* result = current;
+    current += size;
+    return result;
+}
+
+inline void PoolResource::do_deallocate(void* block, std::size_t bytes, std::size_t alignment) {
+    if (!Pooled(bytes, alignment)) {
+        upstream->deallocate(block, bytes, alignment);
+        return;
+    }
+
+    int sizeClass = ClassOf(bytes);
+    auto* freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next = freeLists[sizeClass];
+    freeLists[sizeClass] = freeBlock;
+}
+
+inline void PoolResource::Release() {
+    while (slabs != nullptr) {
+        Slab* next = slabs->next;
+        upstream->deallocate(slabs, SlabSize, alignof(std::max_align_t));
+        slabs = next;
+    }
+    for (FreeBlock*& list : freeLists) list = nullptr;
+    current = nullptr;
+    end = nullptr;
+}
+
+
+class CountingResource : public std::pmr::memory_resource {
+private:
+    std::pmr::memory_resource* upstream;
+    std::size_t bytesInUse;
+    std::size_t peakBytes;
+    std::size_t allocations;
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* block, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : upstream(upstream), bytesInUse(0), peakBytes(0), allocations(0) {}
+    CountingResource(const CountingResource&) = delete;
+    CountingResource& operator=(const CountingResource&) = delete;
+
+    std::size_t GetBytesInUse() const { return bytesInUse; }
+    std::size_t GetPeakBytes() const { return peakBytes; }
+    std::size_t GetAllocationCount() const { return allocations; }
+    // Starts a new measurement from what is in use now.
+    void ResetPeak() { peakBytes = bytesInUse; }
+};
+
+inline void* CountingResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    void* block = upstream->allocate(bytes, alignment);
+    bytesInUse += bytes;
+    peakBytes = std::max(peakBytes, bytesInUse);
+    allocations++;
+    return block;
+}
+
+inline void CountingResource::do_deallocate(void* block, std::size_t bytes, std::size_t alignment) {
+    upstream->deallocate(block, bytes, alignment);
+    bytesInUse -= bytes;
+}
\ No newline at end of file
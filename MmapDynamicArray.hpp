@@ -0,0 +1,331 @@
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "error.hpp"
+#include "Result.hpp"
+#include "BoundsPolicy.hpp"
+#include "DynamicArray.hpp"
+
+// A DynamicArray whose items live in a memory-mapped file, so the data set
+// can be larger than RAM and reopening it costs one mmap instead of a parse.
+// The file is a 64-byte header (magic, version, item size, item count)
+// followed by the raw items; the count in the header is kept current on every
+// resize. Growth is geometric through ftruncate + mremap, and closing the array
+// truncates the file back to the used length. Linux only. Items are copied as
+// bytes, so T must be trivially copyable and must not hold pointers.
+//
+// Can back a sequence directly:
+//     MutableArraySequence<int, Checked, MmapDynamicArray<int>> seq(MmapDynamicArray<int>("data.seq"));
+template <class T, class Policy = Checked>
+class MmapDynamicArray {
+    static_assert(std::is_trivially_copyable_v<T>, "MmapDynamicArray stores items as raw bytes");
+    static_assert(alignof(T) <= 64, "items start 64 bytes into the mapping");
+
+private:
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t elementSize;
+        std::uint64_t count;
+    };
+
+    static constexpr char Magic[8] = { 'S', 'E', 'Q', 'M', 'M', 'A', 'P', '1' };
+    static constexpr std::uint32_t Version = 1;
+    static constexpr std::size_t HeaderSize = 64;
+    static_assert(sizeof(Header) <= HeaderSize);
+
+    std::string path;
+    int fd;
+    unsigned char* mapping;
+    std::size_t mappedBytes;
+    int size;
+    int capacity;
+
+    Header* GetHeader() const { return reinterpret_cast<Header*>(mapping); }
+    T* Items() const { return reinterpret_cast<T*>(mapping + HeaderSize); }
+    static std::size_t BytesFor(int count) { return HeaderSize + sizeof(T) * std::size_t(count); }
+
+    void Open(bool truncate);
+    void Map(std::size_t bytes);
+    void SetSize(int newSize);
+    void Close() noexcept;
+    [[noreturn]] void Fail(const char* operation) const;
+
+public:
+    // Opens path, creating an empty array if the file does not exist yet.
+    explicit MmapDynamicArray(const std::string& path);
+    // Creates (or overwrites) path with count items.
+    MmapDynamicArray(const std::string& path, const T* items, int count);
+    MmapDynamicArray(const MmapDynamicArray<T, Policy>&) = delete;
+    MmapDynamicArray(MmapDynamicArray<T, Policy>&& arr) noexcept;
+    ~MmapDynamicArray();
+
+    MmapDynamicArray<T, Policy>& operator=(const MmapDynamicArray<T, Policy>&) = delete;
+    MmapDynamicArray<T, Policy>& operator=(MmapDynamicArray<T, Policy>&& arr) noexcept;
+
+    T Get(int index) const;
+    Result<T> TryGet(int index) const;
+    T* GetRef(int index) const;
+    T& At(int index);
+    const T& At(int index) const;
+    int GetSize() const { return size; }
+    int GetCapacity() const { return capacity; }
+    const std::string& GetPath() const { return path; }
+    T* Data() { return Items(); }
+    const T* Data() const { return Items(); }
+
+    void Remove(int index);
+
+    void Set(int index, T value);
+    void Resize(int newSize);
+    // Grows the file to hold count items without changing GetSize(), so the
+    // stored count never includes spare room.
+    void Reserve(int count);
+    DynamicArray<T, Policy>* GetSubArray(int startIndex, int endIndex) const;
+
+    // Writes dirty pages back to the file; with wait = false only schedules it.
+    void Flush(bool wait = true);
+
+    T& operator[](int index);
+    const T& operator[](int index) const;
+};
+
+template <class T, class Policy>
+void MmapDynamicArray<T, Policy>::Fail(const char* operation) const {
+    std::string message = std::string(operation) + " " + path + ": " + std::strerror(errno);
+    throw Errors::IoError(message);
+}
+
+template <class T, class Policy>
+void MmapDynamicArray<T, Policy>::Map(std::size_t bytes) {
+    void* address = mapping == nullptr
+        ? ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+        : ::mremap(mapping, mappedBytes, bytes, MREMAP_MAYMOVE);
+    if (address == MAP_FAILED) Fail("mmap");
+
+    mapping = static_cast<unsigned char*>(address);
+    mappedBytes = bytes;
+    capacity = int((bytes - HeaderSize) / sizeof(T));
+}
+
+template <class T, class Policy>
+void MmapDynamicArray<T, Policy>::Open(bool truncate) {
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0), 0644);
+    if (fd < 0) Fail("open");
+
+    try {
+        struct stat info;
+        if (::fstat(fd, &info) != 0) Fail("stat");
+
+        if (info.st_size == 0) {
+            if (::ftruncate(fd, HeaderSize) != 0) Fail("resize");
+            Map(HeaderSize);
+            Header* header = GetHeader();
+            std::memcpy(header->magic, Magic, sizeof(Magic));
+            header->version = Version;
+            header->elementSize = sizeof(T);
+            header->count = 0;
+            return;
+        }
+
+        if (std::size_t(info.st_size) < HeaderSize) throw Errors::InvalidArgument("not a sequence file");
+        Map(std::size_t(info.st_size));
+
+        const Header* header = GetHeader();
+        if (std::memcmp(header->magic, Magic, sizeof(Magic)) != 0 || header->version != Version)
+            throw Errors::InvalidArgument("not a sequence file");
+        if (header->elementSize != sizeof(T)) throw Errors::InvalidArgument("item size mismatch");
+        if (header->count > std::uint64_t(capacity)) throw Errors::InvalidArgument("truncated sequence file");
+        size = int(header->count);
+    }
+    catch (...) {
+        Close();
+        throw;
+    }
+}
+
+template <class T, class Policy>
+void MmapDynamicArray<T, Policy>::Close() noexcept {
+    if (mapping != nullptr) {
+        GetHeader()->count = std::uint64_t(size);
+        ::munmap(mapping, mappedBytes);
+        if (capacity != size) (void)::ftruncate(fd, BytesFor(size));
+    }
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+    mapping = nullptr;
+    mappedBytes = 0;
+    size = 0;
+    capacity = 0;
+}
+
+template <class T, class Policy>
+MmapDynamicArray<T, Policy>::MmapDynamicArray(const std::string& path)
+    : path(path), fd(-1), mapping(nullptr), mappedBytes(0), size(0), capacity(0) {
+    Open(false);
+}
+
+template <class T, class Policy>
+MmapDynamicArray<T, Policy>::MmapDynamicArray(const std::string& path, const T* items, int count)
+    : path(path), fd(-1), mapping(nullptr), mappedBytes(0), size(0), capacity(0) {
+    if (count < 0) throw Errors::NegativeCount();
+    Open(true);
+    try {
+        Reserve(count);
+    }
+    catch (...) {
+        Close();
+        throw;
+    }
+    if (count > 0) std::memcpy(Items(), items, sizeof(T) * std::size_t(count));
+    SetSize(count);
+}
+
+template <class T, class Policy>
+MmapDynamicArray<T, Policy>::MmapDynamicArray(MmapDynamicArray<T, Policy>&& arr) noexcept
+    : path(std::move(arr.path)), fd(arr.fd), mapping(arr.mapping), mappedBytes(arr.mappedBytes),
+      size(arr.size), capacity(arr.capacity) {
+    arr.fd = -1;
+    arr.mapping = nullptr;
+    arr.mappedBytes = 0;
+    arr.size = 0;
+    arr.capacity = 0;
+}
+
+template <class T, class Policy>
+MmapDynamicArray<T, Policy>::~MmapDynamicArray() {
+    Close();
+}
+
+template <class T, class Policy>
+MmapDynamicArray<T, Policy>& MmapDynamicArray<T, Policy>::operator=(MmapDynamicArray<T, Policy>&& arr) noexcept {
+    if (this == &arr) return *this;
+    Close();
+    path = std::move(arr.path);
+    fd = arr.fd;
+    mapping = arr.mapping;
+    mappedBytes = arr.mappedBytes;
+    size = arr.size;
+    capacity = arr.capacity;
+    arr.fd = -1;
+    arr.mapping = nullptr;
+    arr.mappedBytes = 0;
+    arr.size = 0;
+    arr.capacity = 0;
+    return *this;
+}
+
+template <class T, class Policy>
+void MmapDynamicArray<T, Policy>::Reserve(int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    if (count <= capacity) return;
+
+    std::size_t bytes = BytesFor(count);
+    if (::ftruncate(fd, off_t(bytes)) != 0) Fail("resize");
+    Map(bytes);
+}
+
+template <class T, class Policy>
+void MmapDynamicArray<T, Policy>::SetSize(int newSize) {
+    size = newSize;
+    GetHeader()->count = std::uint64_t(newSize);
+}
+
+template <class T, class Policy>
+T MmapDynamicArray<T, Policy>::Get(int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    return Items()[index];
+}
+
+template <class T, class Policy>
+Result<T> MmapDynamicArray<T, Policy>::TryGet(int index) const {
+    if (index < 0 || index >= size) return ErrorCode::INDEX_OUT_OF_RANGE;
+
+    return Items()[index];
+}
+
+template <class T, class Policy>
+T* MmapDynamicArray<T, Policy>::GetRef(int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    return Items() + index;
+}
+
+template <class T, class Policy>
+T& MmapDynamicArray<T, Policy>::At(int index) {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    return Items()[index];
+}
+
+template <class T, class Policy>
+const T& MmapDynamicArray<T, Policy>::At(int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    return Items()[index];
+}
+
+template <class T, class Policy>
+void MmapDynamicArray<T, Policy>::Remove(int index) {
+    if (size == 0) return;
+
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    std::memmove(Items() + index, Items() + index + 1, sizeof(T) * std::size_t(size - index - 1));
+    SetSize(size - 1);
+}
+
+template <class T, class Policy>
+void MmapDynamicArray<T, Policy>::Set(int index, T value) {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    Items()[index] = value;
+}
+
+// Growing past the capacity at least doubles the file, so a run of appends
+// remaps O(log n) times. New items are zeroed.
+template <class T, class Policy>
+void MmapDynamicArray<T, Policy>::Resize(int newSize) {
+    if (newSize < 0) throw Errors::NegativeSize();
+
+    if (newSize > capacity) Reserve(newSize < capacity * 2 ? capacity * 2 : newSize);
+    if (newSize > size) std::memset(static_cast<void*>(Items() + size), 0, sizeof(T) * std::size_t(newSize - size));
+    SetSize(newSize);
+}
+
+template <class T, class Policy>
+DynamicArray<T, Policy>* MmapDynamicArray<T, Policy>::GetSubArray(int startIndex, int endIndex) const {
+    Policy::Require(startIndex >= 0 && endIndex < size && startIndex <= endIndex, ErrorCode::INVALID_INDICES);
+
+    return new DynamicArray<T, Policy>(Items() + startIndex, endIndex - startIndex + 1);
+}
+
+template <class T, class Policy>
+void MmapDynamicArray<T, Policy>::Flush(bool wait) {
+    if (::msync(mapping, mappedBytes, wait ? MS_SYNC : MS_ASYNC) != 0) Fail("flush");
+}
+
+template <class T, class Policy>
+T& MmapDynamicArray<T, Policy>::operator[](int index) {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    return Items()[index];
+}
+
+template <class T, class Policy>
+const T& MmapDynamicArray<T, Policy>::operator[](int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+
+    return Items()[index];
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "ArraySequence.hpp"
+#include "ListSequence.hpp"
+#include "BoundsPolicy.hpp"
+#include "ThreadPool.hpp"
+
+// Order-preserving Map/Where/Reduce/Zip over any Sequence<T>. Array-backed
+// sequences are read in place through Data(); other sequences are copied
+// into an array once. Inputs shorter than SequentialThreshold run on the
+// calling thread. Callbacks may run concurrently and must not share mutable
+// state; Reduce's op must be associative.
+
+namespace Parallel {
+
+    constexpr int SequentialThreshold = 1 << 15;
+    constexpr int Grain = 1 << 13;
+
+    template <class T>
+    class Contiguous {
+    private:
+        DynamicArray<T> copy;
+        const T* data;
+        int size;
+
+        template <class Policy>
+        static const T* ArrayData(const Sequence<T>& seq);
+
+    public:
+        explicit Contiguous(const Sequence<T>& seq);
+
+        const T* Data() const { return data; }
+        int GetLength() const { return size; }
+    };
+
+    template <class T>
+    template <class Policy>
+    const T* Contiguous<T>::ArrayData(const Sequence<T>& seq) {
+        auto array = dynamic_cast<const MutableArraySequence<T, Policy>*>(&seq);
+        return array ? array->Data() : nullptr;
+    }
+
+    template <class T>
+    Contiguous<T>::Contiguous(const Sequence<T>& seq) : copy(0), data(nullptr), size(seq.GetLength()) {
+        data = ArrayData<Checked>(seq);
+        if (!data) data = ArrayData<DebugAssert>(seq);
+        if (!data) data = ArrayData<Unchecked>(seq);
+        if (data) return;
+
+        copy.Resize(size);
+        T* target = copy.Data();
+        if (auto list = dynamic_cast<const MutableListSequence<T>*>(&seq)) {
+            int i = 0;
+            list->ForEach([&](const T& item) { target[i++] = item; });
+        }
+        else {
+            for (int i = 0; i < size; i++) target[i] = seq.At(i);
+        }
+        data = target;
+    }
+
+
+    struct Partition {
+        int pieces;
+        int pieceSize;
+    };
+
+    inline Partition Split(const ThreadPool& pool, int count) {
+        if (count <= 0) return { 0, 1 };
+        if (count < SequentialThreshold || pool.GetThreadCount() == 1) return { 1, count };
+        int pieceSize = std::max(Grain, (count + pool.GetThreadCount() * 4 - 1) / (pool.GetThreadCount() * 4));
+        return { (count + pieceSize - 1) / pieceSize, pieceSize };
+    }
+
+    // body(piece, begin, end) for every piece of the partition.
+    template <class F>
+    void ForEachPiece(ThreadPool& pool, const Partition& parts, int count, F body) {
+        pool.For(parts.pieces, 1, [&](int first, int last) {
+            for (int p = first; p < last; p++)
+                body(p, p * parts.pieceSize, std::min(count, (p + 1) * parts.pieceSize));
+        });
+    }
+
+
+    template <class T, class F>
+    auto Map(const Sequence<T>& seq, F f, ThreadPool& pool = DefaultPool())
+        -> MutableArraySequence<std::decay_t<std::invoke_result_t<F&, const T&>>> {
+        using U = std::decay_t<std::invoke_result_t<F&, const T&>>;
+
+        Contiguous<T> source(seq);
+        int count = source.GetLength();
+        MutableArraySequence<U> result(count);
+
+        const T* in = source.Data();
+        U* out = result.Data();
+        ForEachPiece(pool, Split(pool, count), count, [&](int, int begin, int end) {
+            for (int i = begin; i < end; i++) out[i] = f(in[i]);
+        });
+        return result;
+    }
+
+    template <class T, class F>
+    MutableArraySequence<T> Where(const Sequence<T>& seq, F predicate, ThreadPool& pool = DefaultPool()) {
+        Contiguous<T> source(seq);
+        int count = source.GetLength();
+        Partition parts = Split(pool, count);
+
+        const T* in = source.Data();
+        DynamicArray<char> keep(count);
+        DynamicArray<int> offsets(parts.pieces + 1);
+        char* flags = keep.Data();
+        int* offset = offsets.Data();
+
+        ForEachPiece(pool, parts, count, [&](int piece, int begin, int end) {
+            int matched = 0;
+            for (int i = begin; i < end; i++) {
+                flags[i] = predicate(in[i]) ? 1 : 0;
+                matched += flags[i];
+            }
+            offset[piece + 1] = matched;
+        });
+
+        offset[0] = 0;
+        for (int p = 0; p < parts.pieces; p++) offset[p + 1] += offset[p];
+
+        MutableArraySequence<T> result(offset[parts.pieces]);
+        T* out = result.Data();
+        ForEachPiece(pool, parts, count, [&](int piece, int begin, int end) {
+            int position = offset[piece];
+            for (int i = begin; i < end; i++)
+                if (flags[i]) out[position++] = in[i];
+        });
+        return result;
+    }
+
+    template <class T, class F>
+    T Reduce(const Sequence<T>& seq, T initial, F op, ThreadPool& pool = DefaultPool()) {
+        Contiguous<T> source(seq);
+        int count = source.GetLength();
+        Partition parts = Split(pool, count);
+
+        const T* in = source.Data();
+        DynamicArray<T> partials(parts.pieces);
+        T* partial = partials.Data();
+
+        ForEachPiece(pool, parts, count, [&](int piece, int begin, int end) {
+            T acc = in[begin];
+            for (int i = begin + 1; i < end; i++) acc = op(acc, in[i]);
+            partial[piece] = acc;
+        });
+
+        T result = initial;
+        for (int p = 0; p < parts.pieces; p++) result = op(result, partial[p]);
+        return result;
+    }
+
+    // Pairs items up to the shorter sequence's length.
+    template <class T, class U, class F>
+    auto Zip(const Sequence<T>& first, const Sequence<U>& second, F f, ThreadPool& pool = DefaultPool())
+        -> MutableArraySequence<std::decay_t<std::invoke_result_t<F&, const T&, const U&>>> {
+        using V = std::decay_t<std::invoke_result_t<F&, const T&, const U&>>;
+
+        Contiguous<T> left(first);
+        Contiguous<U> right(second);
+        int count = std::min(left.GetLength(), right.GetLength());
+        MutableArraySequence<V> result(count);
+
+        const T* a = left.Data();
+        const U* b = right.Data();
+        V* out = result.Data();
+        ForEachPiece(pool, Split(pool, count), count, [&](int, int begin, int end) {
+            for (int i = begin; i < end; i++) out[i] = f(a[i], b[i]);
+        });
+        return result;
+    }
+
+    template <class T, class U>
+    MutableArraySequence<std::pair<T, U>> Zip(const Sequence<T>& first, const Sequence<U>& second, ThreadPool& pool = DefaultPool()) {
+        return Zip(first, second, [](const T& a, const U& b) { return std::make_pair(a, b); }, pool);
+    }
+}
\ No newline at end of file
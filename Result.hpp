@@ -0,0 +1,43 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+
+#include "error.hpp"
+
+template <class T>
+class Result {
+private:
+    std::optional<T> value;
+    ErrorCode code;
+
+public:
+    Result(const T& value_) : value(value_), code(ErrorCode::OK) {}
+    Result(T&& value_) : value(std::move(value_)), code(ErrorCode::OK) {}
+    Result(ErrorCode code_) : code(code_) {}
+
+    bool HasValue() const noexcept { return value.has_value(); }
+    explicit operator bool() const noexcept { return HasValue(); }
+    ErrorCode Code() const noexcept { return code; }
+
+    T& Value();
+    const T& Value() const;
+    T ValueOr(T fallback) const;
+};
+
+template <class T>
+T& Result<T>::Value() {
+    if (!value) throw Errors::EmptyValue();
+    return *value;
+}
+
+template <class T>
+const T& Result<T>::Value() const {
+    if (!value) throw Errors::EmptyValue();
+    return *value;
+}
+
+template <class T>
+T Result<T>::ValueOr(T fallback) const {
+    return value ? *value : std::move(fallback);
+}
\ No newline at end of file
@@ -0,0 +1,525 @@
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "error.hpp"
+#include "BoundsPolicy.hpp"
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "ArraySequence.hpp"
+#include "User.hpp"
+#include "View.hpp"
+
+// Binary save/load for DynamicArray, LinkedList and the sequence, stack,
+// queue and deque types. Each container is one record: a 24-byte header
+// (magic "SEQB", format version, flags, item size, item count) followed by
+// the items. Trivially copyable items are written and read as one block;
+// other types go through Codec<T>, which is specialized here for std::string
+// (u32 length + bytes) and User/Student/Professor, and can be specialized for
+// more. Records are host byte order.
+//
+// BinaryWriter and BinaryReader buffer a stream, so several records can share
+// one file. MappedArray maps a file holding a single record of trivially
+// copyable items and reads them in place, without copying.
+
+namespace Serialization {
+
+    constexpr char Magic[4] = { 'S', 'E', 'Q', 'B' };
+    constexpr std::uint16_t Version = 1;
+    constexpr std::uint16_t RawItems = 1;
+
+    struct Header {
+        char magic[4];
+        std::uint16_t version;
+        std::uint16_t flags;
+        std::uint32_t elementSize;
+        std::uint32_t reserved;
+        std::uint64_t count;
+    };
+    static_assert(sizeof(Header) == 24);
+
+
+    class BinaryWriter {
+    private:
+        static constexpr std::size_t Capacity = 64 * 1024;
+
+        std::ostream& out;
+        std::unique_ptr<char[]> buffer;
+        std::size_t used;
+
+    public:
+        explicit BinaryWriter(std::ostream& out) : out(out), buffer(new char[Capacity]), used(0) {}
+        BinaryWriter(const BinaryWriter&) = delete;
+        BinaryWriter& operator=(const BinaryWriter&) = delete;
+        // Flushes what is left; call Flush() first to see write errors.
+        ~BinaryWriter();
+
+        void WriteBytes(const void* bytes, std::size_t count);
+        void WriteString(std::string_view text);
+        template <class T>
+        void Write(const T& item);
+        void Flush();
+    };
+
+    class BinaryReader {
+    private:
+        static constexpr std::size_t Capacity = 64 * 1024;
+
+        std::istream& in;
+        std::unique_ptr<char[]> buffer;
+        std::size_t position;
+        std::size_t end;
+
+    public:
+        explicit BinaryReader(std::istream& in) : in(in), buffer(new char[Capacity]), position(0), end(0) {}
+        BinaryReader(const BinaryReader&) = delete;
+        BinaryReader& operator=(const BinaryReader&) = delete;
+
+        void ReadBytes(void* bytes, std::size_t count);
+        std::string ReadString();
+        template <class T>
+        void Read(T& item);
+    };
+
+
+    template <class T>
+    struct Codec {
+        static_assert(std::is_trivially_copyable_v<T>, "specialize Serialization::Codec for this type");
+
+        static void Write(BinaryWriter& writer, const T& item) { writer.WriteBytes(&item, sizeof(T)); }
+        static void Read(BinaryReader& reader, T& item) { reader.ReadBytes(&item, sizeof(T)); }
+    };
+
+    template <>
+    struct Codec<std::string> {
+        static void Write(BinaryWriter& writer, const std::string& item) { writer.WriteString(item); }
+        static void Read(BinaryReader& reader, std::string& item) { item = reader.ReadString(); }
+    };
+
+    template <>
+    struct Codec<User> {
+        static void Write(BinaryWriter& writer, const User& user) {
+            writer.WriteString(user.name);
+            writer.Write(user.age);
+            writer.Write(user.id);
+        }
+        static void Read(BinaryReader& reader, User& user) {
+            user.name = reader.ReadString();
+            reader.Read(user.age);
+            reader.Read(user.id);
+        }
+    };
+
+    template <>
+    struct Codec<Student> {
+        static void Write(BinaryWriter& writer, const Student& student) {
+            Codec<User>::Write(writer, student);
+            writer.WriteString(student.group);
+            writer.Write(student.exam_pass);
+        }
+        static void Read(BinaryReader& reader, Student& student) {
+            Codec<User>::Read(reader, student);
+            student.group = reader.ReadString();
+            reader.Read(student.exam_pass);
+        }
+    };
+
+    template <>
+    struct Codec<Professor> {
+        static void Write(BinaryWriter& writer, const Professor& professor) {
+            Codec<User>::Write(writer, professor);
+            writer.WriteString(professor.subject);
+            writer.Write(professor.be_on_exam);
+        }
+        static void Read(BinaryReader& reader, Professor& professor) {
+            Codec<User>::Read(reader, professor);
+            professor.subject = reader.ReadString();
+            reader.Read(professor.be_on_exam);
+        }
+    };
+
+
+    inline BinaryWriter::~BinaryWriter() {
+        if (used != 0) out.write(buffer.get(), std::streamsize(used));
+    }
+
+    inline void BinaryWriter::Flush() {
+        if (used != 0) out.write(buffer.get(), std::streamsize(used));
+        used = 0;
+        out.flush();
+        if (!out) throw Errors::IoError("write failed");
+    }
+
+    inline void BinaryWriter::WriteBytes(const void* bytes, std::size_t count) {
+        const char* source = static_cast<const char*>(bytes);
+        if (used + count > Capacity) {
+            out.write(buffer.get(), std::streamsize(used));
+            used = 0;
+            // Large blocks skip the buffer.
+            if (count >= Capacity) {
+                out.write(source, std::streamsize(count));
+                if (!out) throw Errors::IoError("write failed");
+                return;
+            }
+            if (!out) throw Errors::IoError("write failed");
+        }
+        std::memcpy(buffer.get() + used, source, count);
+        used += count;
+    }
+
+    inline void BinaryWriter::WriteString(std::string_view text) {
+        if (text.size() > UINT32_MAX) throw Errors::InvalidArgument("string too long");
+        std::uint32_t length = std::uint32_t(text.size());
+        WriteBytes(&length, sizeof(length));
+        WriteBytes(text.data(), text.size());
+    }
+
+    template <class T>
+    void BinaryWriter::Write(const T& item) {
+        Codec<T>::Write(*this, item);
+    }
+
+    inline void BinaryReader::ReadBytes(void* bytes, std::size_t count) {
+        char* target = static_cast<char*>(bytes);
+        std::size_t buffered = end - position;
+        if (count <= buffered) {
+            std::memcpy(target, buffer.get() + position, count);
+            position += count;
+            return;
+        }
+
+        std::memcpy(target, buffer.get() + position, buffered);
+        target += buffered;
+        count -= buffered;
+        position = end = 0;
+
+        if (count >= Capacity) {
+            in.read(target, std::streamsize(count));
+            if (std::size_t(in.gcount()) != count) throw Errors::IoError("unexpected end of input");
+            return;
+        }
+
+        in.read(buffer.get(), std::streamsize(Capacity));
+        end = std::size_t(in.gcount());
+        if (end < count) throw Errors::IoError("unexpected end of input");
+        std::memcpy(target, buffer.get(), count);
+        position = count;
+    }
+
+    inline std::string BinaryReader::ReadString() {
+        std::uint32_t length;
+        ReadBytes(&length, sizeof(length));
+        std::string text(length, '\0');
+        ReadBytes(text.data(), length);
+        return text;
+    }
+
+    template <class T>
+    void BinaryReader::Read(T& item) {
+        Codec<T>::Read(*this, item);
+    }
+
+
+    template <class T>
+    void WriteHeader(BinaryWriter& writer, int count) {
+        Header header{};
+        std::memcpy(header.magic, Magic, sizeof(Magic));
+        header.version = Version;
+        header.flags = std::is_trivially_copyable_v<T> ? RawItems : 0;
+        header.elementSize = sizeof(T);
+        header.count = std::uint64_t(count);
+        writer.WriteBytes(&header, sizeof(header));
+    }
+
+    template <class T>
+    int CheckHeader(const Header& header) {
+        if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0) throw Errors::InvalidArgument("not a serialized sequence");
+        if (header.version != Version) throw Errors::InvalidArgument("unsupported format version");
+        std::uint16_t flags = std::is_trivially_copyable_v<T> ? RawItems : 0;
+        if (header.elementSize != sizeof(T) || header.flags != flags) throw Errors::InvalidArgument("item type mismatch");
+        if (header.count > std::uint64_t(INT32_MAX)) throw Errors::InvalidArgument("too many items");
+        return int(header.count);
+    }
+
+    template <class T>
+    int ReadHeader(BinaryReader& reader) {
+        Header header;
+        reader.ReadBytes(&header, sizeof(header));
+        return CheckHeader<T>(header);
+    }
+
+    template <class T>
+    void WriteItems(BinaryWriter& writer, const T* items, int count) {
+        if constexpr (std::is_trivially_copyable_v<T>)
+            writer.WriteBytes(items, sizeof(T) * std::size_t(count));
+        else
+            for (int i = 0; i < count; i++) Codec<T>::Write(writer, items[i]);
+    }
+
+    template <class T>
+    void ReadItems(BinaryReader& reader, T* items, int count) {
+        if constexpr (std::is_trivially_copyable_v<T>)
+            reader.ReadBytes(items, sizeof(T) * std::size_t(count));
+        else
+            for (int i = 0; i < count; i++) Codec<T>::Read(reader, items[i]);
+    }
+
+
+    // What a container offers decides how it is walked and refilled:
+    // contiguous Data() is copied in bulk, ForEach beats Get(i) on lists and
+    // trees, and Push/Enqueue/PushBack fill the adapters that have no Append.
+    template <class C>
+    using ItemOf = std::decay_t<decltype(std::declval<const C&>().Get(0))>;
+
+    template <class C, class = void>
+    struct HasLength : std::false_type {};
+    template <class C>
+    struct HasLength<C, std::void_t<decltype(std::declval<const C&>().GetLength())>> : std::true_type {};
+
+    template <class C, class = void>
+    struct HasData : std::false_type {};
+    template <class C>
+    struct HasData<C, std::void_t<decltype(std::declval<const C&>().Data())>> : std::true_type {};
+
+    template <class C, class = void>
+    struct HasForEach : std::false_type {};
+    template <class C>
+    struct HasForEach<C, std::void_t<decltype(std::declval<const C&>().ForEach(std::declval<void (*)(const ItemOf<C>&)>()))>> : std::true_type {};
+
+    template <class C, class = void>
+    struct HasResize : std::false_type {};
+    template <class C>
+    struct HasResize<C, std::void_t<decltype(std::declval<C&>().Resize(0))>> : std::true_type {};
+
+    template <class C, class = void>
+    struct HasAppend : std::false_type {};
+    template <class C>
+    struct HasAppend<C, std::void_t<decltype(std::declval<C&>().Append(std::declval<ItemOf<C>>()))>> : std::true_type {};
+
+    template <class C, class = void>
+    struct HasPush : std::false_type {};
+    template <class C>
+    struct HasPush<C, std::void_t<decltype(std::declval<C&>().Push(std::declval<ItemOf<C>>()))>> : std::true_type {};
+
+    template <class C, class = void>
+    struct HasEnqueue : std::false_type {};
+    template <class C>
+    struct HasEnqueue<C, std::void_t<decltype(std::declval<C&>().Enqueue(std::declval<ItemOf<C>>()))>> : std::true_type {};
+
+    template <class C, class = void>
+    struct HasReserve : std::false_type {};
+    template <class C>
+    struct HasReserve<C, std::void_t<decltype(std::declval<C&>().Reserve(0))>> : std::true_type {};
+
+    // Only the exact type: derived sequences (stacks, indexed sequences) may
+    // keep state of their own and are loaded through Append.
+    template <class C>
+    struct IsArraySequence : std::false_type {};
+    template <class T, class Policy>
+    struct IsArraySequence<MutableArraySequence<T, Policy>> : std::true_type {};
+
+    template <class C>
+    int LengthOf(const C& container) {
+        if constexpr (HasLength<C>::value) return container.GetLength();
+        else return container.GetSize();
+    }
+
+    template <class C>
+    void Add(C& container, const ItemOf<C>& item) {
+        if constexpr (HasAppend<C>::value) container.Append(item);
+        else if constexpr (HasPush<C>::value) container.Push(item);
+        else if constexpr (HasEnqueue<C>::value) container.Enqueue(item);
+        else container.PushBack(item);
+    }
+
+    // Reads straight into a fresh array and moves it in, so there is a single
+    // allocation from the sequence's own resource.
+    template <class T, class Policy>
+    void LoadArraySequence(BinaryReader& reader, MutableArraySequence<T, Policy>& sequence, int count) {
+        DynamicArray<T, Policy> items(count, sequence.GetResource());
+        ReadItems(reader, items.Data(), count);
+        sequence = MutableArraySequence<T, Policy>(std::move(items));
+    }
+
+
+    template <class C>
+    void Save(BinaryWriter& writer, const C& container) {
+        using T = ItemOf<C>;
+        int count = LengthOf(container);
+        WriteHeader<T>(writer, count);
+
+        auto write = [&writer](const T& item) { Codec<T>::Write(writer, item); };
+        if constexpr (HasData<C>::value)
+            WriteItems(writer, container.Data(), count);
+        else if constexpr (HasForEach<C>::value)
+            container.ForEach(write);
+        else if constexpr (std::is_base_of_v<Sequence<T>, C>)
+            View::From(static_cast<const Sequence<T>&>(container)).ForEach(write);
+        else
+            for (int i = 0; i < count; i++) write(container.Get(i));
+    }
+
+    // Arrays are resized to the stored length; every other container must be
+    // empty and gets the items appended (pushed, enqueued) in saved order.
+    template <class C>
+    void Load(BinaryReader& reader, C& container) {
+        using T = ItemOf<C>;
+        int count = ReadHeader<T>(reader);
+
+        if constexpr (HasResize<C>::value && HasData<C>::value) {
+            container.Resize(count);
+            ReadItems(reader, container.Data(), count);
+        }
+        else {
+            if (LengthOf(container) != 0) throw Errors::InvalidArgument("load target is not empty");
+
+            if constexpr (IsArraySequence<C>::value) {
+                LoadArraySequence(reader, container, count);
+            }
+            else {
+                if constexpr (HasReserve<C>::value) container.Reserve(count);
+                T item{};
+                for (int i = 0; i < count; i++) {
+                    Codec<T>::Read(reader, item);
+                    Add(container, item);
+                }
+            }
+        }
+    }
+
+    template <class C>
+    void SaveFile(const std::string& path, const C& container) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw Errors::IoError("cannot open " + path);
+        BinaryWriter writer(out);
+        Save(writer, container);
+        writer.Flush();
+    }
+
+    template <class C>
+    void LoadFile(const std::string& path, C& container) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw Errors::IoError("cannot open " + path);
+        BinaryReader reader(in);
+        Load(reader, container);
+    }
+
+
+    // Read-only view of a file written by SaveFile for trivially copyable T.
+    // The items are used where they lie in the mapping; pages are read in on
+    // first touch.
+    template <class T, class Policy = Checked>
+    class MappedArray {
+        static_assert(std::is_trivially_copyable_v<T>, "only raw items can be mapped");
+        static_assert(alignof(T) <= alignof(Header), "items start right after the header");
+
+    private:
+        void* mapping;
+        std::size_t mappedBytes;
+        const T* data;
+        int size;
+
+        void Unmap() noexcept;
+
+    public:
+        explicit MappedArray(const std::string& path);
+        MappedArray(const MappedArray<T, Policy>&) = delete;
+        MappedArray(MappedArray<T, Policy>&& other) noexcept;
+        ~MappedArray() { Unmap(); }
+
+        MappedArray<T, Policy>& operator=(const MappedArray<T, Policy>&) = delete;
+        MappedArray<T, Policy>& operator=(MappedArray<T, Policy>&& other) noexcept;
+
+        T Get(int index) const;
+        const T& At(int index) const;
+        const T& operator[](int index) const { return At(index); }
+        const T* Data() const { return data; }
+        int GetLength() const { return size; }
+    };
+
+    template <class T, class Policy>
+    MappedArray<T, Policy>::MappedArray(const std::string& path) : mapping(nullptr), mappedBytes(0), data(nullptr), size(0) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw Errors::IoError("cannot open " + path + ": " + std::strerror(errno));
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0 || std::size_t(info.st_size) < sizeof(Header)) {
+            ::close(fd);
+            throw Errors::InvalidArgument("not a serialized sequence");
+        }
+        mappedBytes = std::size_t(info.st_size);
+        mapping = ::mmap(nullptr, mappedBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            mapping = nullptr;
+            throw Errors::IoError("cannot map " + path + ": " + std::strerror(errno));
+        }
+
+        try {
+            const Header& header = *static_cast<const Header*>(mapping);
+            size = CheckHeader<T>(header);
+            if (sizeof(Header) + sizeof(T) * std::size_t(size) > mappedBytes) throw Errors::InvalidArgument("truncated sequence file");
+        }
+        catch (...) {
+            Unmap();
+            throw;
+        }
+        data = reinterpret_cast<const T*>(static_cast<const char*>(mapping) + sizeof(Header));
+    }
+
+    template <class T, class Policy>
+    MappedArray<T, Policy>::MappedArray(MappedArray<T, Policy>&& other) noexcept
+        : mapping(other.mapping), mappedBytes(other.mappedBytes), data(other.data), size(other.size) {
+        other.mapping = nullptr;
+        other.mappedBytes = 0;
+        other.data = nullptr;
+        other.size = 0;
+    }
+
+    template <class T, class Policy>
+    MappedArray<T, Policy>& MappedArray<T, Policy>::operator=(MappedArray<T, Policy>&& other) noexcept {
+        if (this == &other) return *this;
+        Unmap();
+        std::swap(mapping, other.mapping);
+        std::swap(mappedBytes, other.mappedBytes);
+        std::swap(data, other.data);
+        std::swap(size, other.size);
+        return *this;
+    }
+
+    template <class T, class Policy>
+    void MappedArray<T, Policy>::Unmap() noexcept {
+        if (mapping != nullptr) ::munmap(mapping, mappedBytes);
+        mapping = nullptr;
+        mappedBytes = 0;
+        data = nullptr;
+        size = 0;
+    }
+
+    template <class T, class Policy>
+    T MappedArray<T, Policy>::Get(int index) const {
+        Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+        return data[index];
+    }
+
+    template <class T, class Policy>
+    const T& MappedArray<T, Policy>::At(int index) const {
+        Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+        return data[index];
+    }
+}
\ No newline at end of file
@@ -0,0 +1,483 @@
+#pragma once
+
+#include <cstddef>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SEQ_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define SEQ_SIMD_X86 0
+#endif
+
+// Bulk kernels over raw int/double storage. Each kernel has a scalar
+// reference version plus SSE4.1 and AVX2 versions; the widest level the CPU
+// supports is picked once at runtime. Callers guarantee count > 0 for Min/Max.
+// Vector Sum over doubles adds in a different order than the scalar loop, so
+// results may differ in the last bits.
+
+namespace Simd {
+
+    enum class Level { SCALAR, SSE4, AVX2 };
+
+    enum class Compare { EQUAL, NOT_EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL };
+
+    inline Level Detect() {
+#if SEQ_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return Level::AVX2;
+        if (__builtin_cpu_supports("sse4.1")) return Level::SSE4;
+#endif
+        return Level::SCALAR;
+    }
+
+    inline Level ActiveLevel() {
+        static const Level level = Detect();
+        return level;
+    }
+
+    namespace Scalar {
+
+        template <class T>
+        bool Matches(T x, Compare op, T value) {
+            switch (op) {
+            case Compare::EQUAL: return x == value;
+            case Compare::NOT_EQUAL: return x != value;
+            case Compare::LESS: return x < value;
+            case Compare::LESS_EQUAL: return x <= value;
+            case Compare::GREATER: return x > value;
+            case Compare::GREATER_EQUAL: return x >= value;
+            }
+            return false;
+        }
+
+        inline long long Sum(const int* data, int count) {
+            long long sum = 0;
+            for (int i = 0; i < count; i++) sum += data[i];
+            return sum;
+        }
+
+        inline double Sum(const double* data, int count) {
+            double sum = 0;
+            for (int i = 0; i < count; i++) sum += data[i];
+            return sum;
+        }
+
+        template <class T>
+        T Min(const T* data, int count) {
+            T result = data[0];
+            for (int i = 1; i < count; i++)
+                if (data[i] < result) result = data[i];
+            return result;
+        }
+
+        template <class T>
+        T Max(const T* data, int count) {
+            T result = data[0];
+            for (int i = 1; i < count; i++)
+                if (result < data[i]) result = data[i];
+            return result;
+        }
+
+        template <class T>
+        int CountIf(const T* data, int count, Compare op, T value) {
+            int result = 0;
+            for (int i = 0; i < count; i++)
+                if (Matches(data[i], op, value)) result++;
+            return result;
+        }
+
+        template <class T>
+        int IndexOf(const T* data, int count, T value) {
+            for (int i = 0; i < count; i++)
+                if (data[i] == value) return i;
+            return -1;
+        }
+
+        template <class T>
+        bool Equal(const T* lhs, const T* rhs, int count) {
+            for (int i = 0; i < count; i++)
+                if (!(lhs[i] == rhs[i])) return false;
+            return true;
+        }
+    }
+
+#if SEQ_SIMD_X86
+
+    namespace Avx2 {
+
+        __attribute__((target("avx2"))) inline long long Sum(const int* data, int count) {
+            __m256i acc = _mm256_setzero_si256();
+            int i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+                acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+            }
+            alignas(32) long long lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] + Scalar::Sum(data + i, count - i);
+        }
+
+        __attribute__((target("avx2"))) inline double Sum(const double* data, int count) {
+            __m256d acc0 = _mm256_setzero_pd();
+            __m256d acc1 = _mm256_setzero_pd();
+            int i = 0;
+            for (; i + 8 <= count; i += 8) {
+                acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(data + i));
+                acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(data + i + 4));
+            }
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, _mm256_add_pd(acc0, acc1));
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] + Scalar::Sum(data + i, count - i);
+        }
+
+        __attribute__((target("avx2"))) inline int Min(const int* data, int count) {
+            if (count < 8) return Scalar::Min(data, count);
+            __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            int i = 8;
+            for (; i + 8 <= count; i += 8)
+                acc = _mm256_min_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+            alignas(32) int lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+            int result = Scalar::Min(lanes, 8);
+            for (; i < count; i++)
+                if (data[i] < result) result = data[i];
+            return result;
+        }
+
+        __attribute__((target("avx2"))) inline int Max(const int* data, int count) {
+            if (count < 8) return Scalar::Max(data, count);
+            __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            int i = 8;
+            for (; i + 8 <= count; i += 8)
+                acc = _mm256_max_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+            alignas(32) int lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+            int result = Scalar::Max(lanes, 8);
+            for (; i < count; i++)
+                if (result < data[i]) result = data[i];
+            return result;
+        }
+
+        __attribute__((target("avx2"))) inline double Min(const double* data, int count) {
+            if (count < 4) return Scalar::Min(data, count);
+            __m256d acc = _mm256_loadu_pd(data);
+            int i = 4;
+            for (; i + 4 <= count; i += 4)
+                acc = _mm256_min_pd(acc, _mm256_loadu_pd(data + i));
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, acc);
+            double result = Scalar::Min(lanes, 4);
+            for (; i < count; i++)
+                if (data[i] < result) result = data[i];
+            return result;
+        }
+
+        __attribute__((target("avx2"))) inline double Max(const double* data, int count) {
+            if (count < 4) return Scalar::Max(data, count);
+            __m256d acc = _mm256_loadu_pd(data);
+            int i = 4;
+            for (; i + 4 <= count; i += 4)
+                acc = _mm256_max_pd(acc, _mm256_loadu_pd(data + i));
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, acc);
+            double result = Scalar::Max(lanes, 4);
+            for (; i < count; i++)
+                if (result < data[i]) result = data[i];
+            return result;
+        }
+
+        __attribute__((target("avx2"))) inline __m256i Mask(__m256i x, Compare op, __m256i value) {
+            switch (op) {
+            case Compare::EQUAL: return _mm256_cmpeq_epi32(x, value);
+            case Compare::NOT_EQUAL: return _mm256_xor_si256(_mm256_cmpeq_epi32(x, value), _mm256_set1_epi32(-1));
+            case Compare::LESS: return _mm256_cmpgt_epi32(value, x);
+            case Compare::LESS_EQUAL: return _mm256_xor_si256(_mm256_cmpgt_epi32(x, value), _mm256_set1_epi32(-1));
+            case Compare::GREATER: return _mm256_cmpgt_epi32(x, value);
+            case Compare::GREATER_EQUAL: return _mm256_xor_si256(_mm256_cmpgt_epi32(value, x), _mm256_set1_epi32(-1));
+            }
+            return _mm256_setzero_si256();
+        }
+
+        __attribute__((target("avx2"))) inline int CountIf(const int* data, int count, Compare op, int value) {
+            __m256i target = _mm256_set1_epi32(value);
+            __m256i acc = _mm256_setzero_si256();
+            int i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                acc = _mm256_sub_epi32(acc, Mask(v, op, target));
+            }
+            alignas(32) int lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+            int result = 0;
+            for (int lane = 0; lane < 8; lane++) result += lanes[lane];
+            return result + Scalar::CountIf(data + i, count - i, op, value);
+        }
+
+        __attribute__((target("avx2"))) inline __m256d Mask(__m256d x, Compare op, __m256d value) {
+            switch (op) {
+            case Compare::EQUAL: return _mm256_cmp_pd(x, value, _CMP_EQ_OQ);
+            case Compare::NOT_EQUAL: return _mm256_cmp_pd(x, value, _CMP_NEQ_UQ);
+            case Compare::LESS: return _mm256_cmp_pd(x, value, _CMP_LT_OQ);
+            case Compare::LESS_EQUAL: return _mm256_cmp_pd(x, value, _CMP_LE_OQ);
+            case Compare::GREATER: return _mm256_cmp_pd(x, value, _CMP_GT_OQ);
+            case Compare::GREATER_EQUAL: return _mm256_cmp_pd(x, value, _CMP_GE_OQ);
+            }
+            return _mm256_setzero_pd();
+        }
+
+        __attribute__((target("avx2,popcnt"))) inline int CountIf(const double* data, int count, Compare op, double value) {
+            __m256d target = _mm256_set1_pd(value);
+            int result = 0;
+            int i = 0;
+            for (; i + 4 <= count; i += 4)
+                result += __builtin_popcount(_mm256_movemask_pd(Mask(_mm256_loadu_pd(data + i), op, target)));
+            return result + Scalar::CountIf(data + i, count - i, op, value);
+        }
+
+        __attribute__((target("avx2"))) inline int IndexOf(const int* data, int count, int value) {
+            __m256i target = _mm256_set1_epi32(value);
+            int i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, target)));
+                if (mask != 0) return i + __builtin_ctz(mask);
+            }
+            int tail = Scalar::IndexOf(data + i, count - i, value);
+            return tail < 0 ? -1 : i + tail;
+        }
+
+        __attribute__((target("avx2"))) inline int IndexOf(const double* data, int count, double value) {
+            __m256d target = _mm256_set1_pd(value);
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(data + i), target, _CMP_EQ_OQ));
+                if (mask != 0) return i + __builtin_ctz(mask);
+            }
+            int tail = Scalar::IndexOf(data + i, count - i, value);
+            return tail < 0 ? -1 : i + tail;
+        }
+
+        __attribute__((target("avx2"))) inline bool Equal(const int* lhs, const int* rhs, int count) {
+            int i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+                __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+                if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(a, b)) != -1) return false;
+            }
+            return Scalar::Equal(lhs + i, rhs + i, count - i);
+        }
+
+        __attribute__((target("avx2"))) inline bool Equal(const double* lhs, const double* rhs, int count) {
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m256d eq = _mm256_cmp_pd(_mm256_loadu_pd(lhs + i), _mm256_loadu_pd(rhs + i), _CMP_EQ_OQ);
+                if (_mm256_movemask_pd(eq) != 0xF) return false;
+            }
+            return Scalar::Equal(lhs + i, rhs + i, count - i);
+        }
+    }
+
+    namespace Sse4 {
+
+        __attribute__((target("sse4.1"))) inline long long Sum(const int* data, int count) {
+            __m128i acc = _mm_setzero_si128();
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(v));
+                acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+            }
+            alignas(16) long long lanes[2];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            return lanes[0] + lanes[1] + Scalar::Sum(data + i, count - i);
+        }
+
+        __attribute__((target("sse4.1"))) inline double Sum(const double* data, int count) {
+            __m128d acc0 = _mm_setzero_pd();
+            __m128d acc1 = _mm_setzero_pd();
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                acc0 = _mm_add_pd(acc0, _mm_loadu_pd(data + i));
+                acc1 = _mm_add_pd(acc1, _mm_loadu_pd(data + i + 2));
+            }
+            alignas(16) double lanes[2];
+            _mm_store_pd(lanes, _mm_add_pd(acc0, acc1));
+            return lanes[0] + lanes[1] + Scalar::Sum(data + i, count - i);
+        }
+
+        __attribute__((target("sse4.1"))) inline int Min(const int* data, int count) {
+            if (count < 4) return Scalar::Min(data, count);
+            __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            int i = 4;
+            for (; i + 4 <= count; i += 4)
+                acc = _mm_min_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+            alignas(16) int lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            int result = Scalar::Min(lanes, 4);
+            for (; i < count; i++)
+                if (data[i] < result) result = data[i];
+            return result;
+        }
+
+        __attribute__((target("sse4.1"))) inline int Max(const int* data, int count) {
+            if (count < 4) return Scalar::Max(data, count);
+            __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            int i = 4;
+            for (; i + 4 <= count; i += 4)
+                acc = _mm_max_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+            alignas(16) int lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            int result = Scalar::Max(lanes, 4);
+            for (; i < count; i++)
+                if (result < data[i]) result = data[i];
+            return result;
+        }
+
+        __attribute__((target("sse4.1"))) inline double Min(const double* data, int count) {
+            if (count < 2) return Scalar::Min(data, count);
+            __m128d acc = _mm_loadu_pd(data);
+            int i = 2;
+            for (; i + 2 <= count; i += 2)
+                acc = _mm_min_pd(acc, _mm_loadu_pd(data + i));
+            alignas(16) double lanes[2];
+            _mm_store_pd(lanes, acc);
+            double result = Scalar::Min(lanes, 2);
+            for (; i < count; i++)
+                if (data[i] < result) result = data[i];
+            return result;
+        }
+
+        __attribute__((target("sse4.1"))) inline double Max(const double* data, int count) {
+            if (count < 2) return Scalar::Max(data, count);
+            __m128d acc = _mm_loadu_pd(data);
+            int i = 2;
+            for (; i + 2 <= count; i += 2)
+                acc = _mm_max_pd(acc, _mm_loadu_pd(data + i));
+            alignas(16) double lanes[2];
+            _mm_store_pd(lanes, acc);
+            double result = Scalar::Max(lanes, 2);
+            for (; i < count; i++)
+                if (result < data[i]) result = data[i];
+            return result;
+        }
+
+        __attribute__((target("sse4.1"))) inline __m128i Mask(__m128i x, Compare op, __m128i value) {
+            switch (op) {
+            case Compare::EQUAL: return _mm_cmpeq_epi32(x, value);
+            case Compare::NOT_EQUAL: return _mm_xor_si128(_mm_cmpeq_epi32(x, value), _mm_set1_epi32(-1));
+            case Compare::LESS: return _mm_cmplt_epi32(x, value);
+            case Compare::LESS_EQUAL: return _mm_xor_si128(_mm_cmpgt_epi32(x, value), _mm_set1_epi32(-1));
+            case Compare::GREATER: return _mm_cmpgt_epi32(x, value);
+            case Compare::GREATER_EQUAL: return _mm_xor_si128(_mm_cmplt_epi32(x, value), _mm_set1_epi32(-1));
+            }
+            return _mm_setzero_si128();
+        }
+
+        __attribute__((target("sse4.1"))) inline int CountIf(const int* data, int count, Compare op, int value) {
+            __m128i target = _mm_set1_epi32(value);
+            __m128i acc = _mm_setzero_si128();
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                acc = _mm_sub_epi32(acc, Mask(v, op, target));
+            }
+            alignas(16) int lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] + Scalar::CountIf(data + i, count - i, op, value);
+        }
+
+        __attribute__((target("sse4.1"))) inline __m128d Mask(__m128d x, Compare op, __m128d value) {
+            switch (op) {
+            case Compare::EQUAL: return _mm_cmpeq_pd(x, value);
+            case Compare::NOT_EQUAL: return _mm_cmpneq_pd(x, value);
+            case Compare::LESS: return _mm_cmplt_pd(x, value);
+            case Compare::LESS_EQUAL: return _mm_cmple_pd(x, value);
+            case Compare::GREATER: return _mm_cmpgt_pd(x, value);
+            case Compare::GREATER_EQUAL: return _mm_cmpge_pd(x, value);
+            }
+            return _mm_setzero_pd();
+        }
+
+        __attribute__((target("sse4.1"))) inline int CountIf(const double* data, int count, Compare op, double value) {
+            static const int bits[4] = { 0, 1, 1, 2 };
+            __m128d target = _mm_set1_pd(value);
+            int result = 0;
+            int i = 0;
+            for (; i + 2 <= count; i += 2)
+                result += bits[_mm_movemask_pd(Mask(_mm_loadu_pd(data + i), op, target))];
+            return result + Scalar::CountIf(data + i, count - i, op, value);
+        }
+
+        __attribute__((target("sse4.1"))) inline int IndexOf(const int* data, int count, int value) {
+            __m128i target = _mm_set1_epi32(value);
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, target)));
+                if (mask != 0) return i + __builtin_ctz(mask);
+            }
+            int tail = Scalar::IndexOf(data + i, count - i, value);
+            return tail < 0 ? -1 : i + tail;
+        }
+
+        __attribute__((target("sse4.1"))) inline int IndexOf(const double* data, int count, double value) {
+            __m128d target = _mm_set1_pd(value);
+            int i = 0;
+            for (; i + 2 <= count; i += 2) {
+                int mask = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(data + i), target));
+                if (mask != 0) return i + __builtin_ctz(mask);
+            }
+            int tail = Scalar::IndexOf(data + i, count - i, value);
+            return tail < 0 ? -1 : i + tail;
+        }
+
+        __attribute__((target("sse4.1"))) inline bool Equal(const int* lhs, const int* rhs, int count) {
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+                __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(a, b)) != 0xFFFF) return false;
+            }
+            return Scalar::Equal(lhs + i, rhs + i, count - i);
+        }
+
+        __attribute__((target("sse4.1"))) inline bool Equal(const double* lhs, const double* rhs, int count) {
+            int i = 0;
+            for (; i + 2 <= count; i += 2) {
+                if (_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(lhs + i), _mm_loadu_pd(rhs + i))) != 0x3) return false;
+            }
+            return Scalar::Equal(lhs + i, rhs + i, count - i);
+        }
+    }
+
+#define SEQ_SIMD_DISPATCH(call)                                     \
+    switch (ActiveLevel()) {                                        \
+    case Level::AVX2: return Avx2::call;                            \
+    case Level::SSE4: return Sse4::call;                            \
+    default: return Scalar::call;                                   \
+    }
+#else
+#define SEQ_SIMD_DISPATCH(call) return Scalar::call;
+#endif
+
+    inline long long Sum(const int* data, int count) { SEQ_SIMD_DISPATCH(Sum(data, count)) }
+    inline double Sum(const double* data, int count) { SEQ_SIMD_DISPATCH(Sum(data, count)) }
+
+    inline int Min(const int* data, int count) { SEQ_SIMD_DISPATCH(Min(data, count)) }
+    inline double Min(const double* data, int count) { SEQ_SIMD_DISPATCH(Min(data, count)) }
+
+    inline int Max(const int* data, int count) { SEQ_SIMD_DISPATCH(Max(data, count)) }
+    inline double Max(const double* data, int count) { SEQ_SIMD_DISPATCH(Max(data, count)) }
+
+    inline int CountIf(const int* data, int count, Compare op, int value) { SEQ_SIMD_DISPATCH(CountIf(data, count, op, value)) }
+    inline int CountIf(const double* data, int count, Compare op, double value) { SEQ_SIMD_DISPATCH(CountIf(data, count, op, value)) }
+
+    inline int IndexOf(const int* data, int count, int value) { SEQ_SIMD_DISPATCH(IndexOf(data, count, value)) }
+    inline int IndexOf(const double* data, int count, double value) { SEQ_SIMD_DISPATCH(IndexOf(data, count, value)) }
+
+    inline bool Equal(const int* lhs, const int* rhs, int count) { SEQ_SIMD_DISPATCH(Equal(lhs, rhs, count)) }
+    inline bool Equal(const double* lhs, const double* rhs, int count) { SEQ_SIMD_DISPATCH(Equal(lhs, rhs, count)) }
+
+#undef SEQ_SIMD_DISPATCH
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "DynamicArray.hpp"
+#include "ThreadPool.hpp"
+
+// Sorting kernels over contiguous storage, used by MutableArraySequence.
+// IntroSort is in place and unstable; ParallelSort sorts pieces with
+// IntroSort on the pool and merges them with co-ranked (merge path) splits,
+// so even the last merge is spread over every thread; RadixSort is a stable
+// LSD sort on an integral key.
+
+namespace Sorting {
+
+    constexpr int InsertionThreshold = 16;
+    constexpr int ParallelThreshold = 1 << 16;
+    constexpr int MergeGrain = 1 << 14;
+
+    template <class T, class Compare>
+    void InsertionSort(T* data, int count, Compare& cmp) {
+        for (int i = 1; i < count; i++) {
+            T item = std::move(data[i]);
+            int j = i;
+            for (; j > 0 && cmp(item, data[j - 1]); j--)
+                data[j] = std::move(data[j - 1]);
+            data[j] = std::move(item);
+        }
+    }
+
+    template <class T, class Compare>
+    void SiftDown(T* data, int root, int count, Compare& cmp) {
+        for (int child = 2 * root + 1; child < count; child = 2 * root + 1) {
+            if (child + 1 < count && cmp(data[child], data[child + 1])) child++;
+            if (!cmp(data[root], data[child])) return;
+            std::swap(data[root], data[child]);
+            root = child;
+        }
+    }
+
+    template <class T, class Compare>
+    void HeapSort(T* data, int count, Compare& cmp) {
+        for (int i = count / 2 - 1; i >= 0; i--) SiftDown(data, i, count, cmp);
+        for (int end = count - 1; end > 0; end--) {
+            std::swap(data[0], data[end]);
+            SiftDown(data, 0, end, cmp);
+        }
+    }
+
+    template <class T, class Compare>
+    void IntroSortLoop(T* data, int count, int depth, Compare& cmp) {
+        while (count > InsertionThreshold) {
+            if (depth-- == 0) {
+                HeapSort(data, count, cmp);
+                return;
+            }
+
+            int mid = count / 2;
+            if (cmp(data[mid], data[0])) std::swap(data[mid], data[0]);
+            if (cmp(data[count - 1], data[mid])) std::swap(data[count - 1], data[mid]);
+            if (cmp(data[mid], data[0])) std::swap(data[mid], data[0]);
+            T pivot = data[mid];
+
+            // Hoare partition; the median of three keeps both scans in bounds.
+            int i = -1;
+            int j = count;
+            for (;;) {
+                do i++; while (cmp(data[i], pivot));
+                do j--; while (cmp(pivot, data[j]));
+                if (i >= j) break;
+                std::swap(data[i], data[j]);
+            }
+
+            int leftCount = j + 1;
+            if (leftCount < count - leftCount) {
+                IntroSortLoop(data, leftCount, depth, cmp);
+                data += leftCount;
+                count -= leftCount;
+            }
+            else {
+                IntroSortLoop(data + leftCount, count - leftCount, depth, cmp);
+                count = leftCount;
+            }
+        }
+        InsertionSort(data, count, cmp);
+    }
+
+    template <class T, class Compare>
+    void IntroSort(T* data, int count, Compare cmp) {
+        int depth = 0;
+        for (int n = count; n > 1; n >>= 1) depth += 2;
+        IntroSortLoop(data, count, depth, cmp);
+    }
+
+    // Stable: on ties the item from `left` goes first.
+    template <class T, class Compare>
+    void Merge(T* left, int leftCount, T* right, int rightCount, T* out, Compare& cmp) {
+        int i = 0, j = 0;
+        while (i < leftCount && j < rightCount) {
+            if (cmp(right[j], left[i])) *out++ = std::move(right[j++]);
+            else *out++ = std::move(left[i++]);
+        }
+        while (i < leftCount) *out++ = std::move(left[i++]);
+        while (j < rightCount) *out++ = std::move(right[j++]);
+    }
+
+    // Number of items the first `outputs` merged items take from `left`.
+    template <class T, class Compare>
+    int CoRank(int outputs, const T* left, int leftCount, const T* right, int rightCount, Compare& cmp) {
+        int low = std::max(0, outputs - rightCount);
+        int high = std::min(outputs, leftCount);
+        while (low < high) {
+            int i = low + (high - low) / 2;
+            int j = outputs - i;
+            if (j > 0 && !cmp(right[j - 1], left[i])) low = i + 1;
+            else high = i;
+        }
+        return low;
+    }
+
+    template <class T, class Compare>
+    void ParallelSort(T* data, int count, Compare cmp, ThreadPool& pool) {
+        int threads = pool.GetThreadCount();
+        int pieces = 1;
+        while (pieces < threads && count / (pieces * 2) >= MergeGrain) pieces *= 2;
+        if (pieces == 1) {
+            IntroSort(data, count, cmp);
+            return;
+        }
+
+        int pieceSize = (count + pieces - 1) / pieces;
+        pool.For(pieces, 1, [&](int first, int last) {
+            for (int p = first; p < last; p++) {
+                int begin = std::min(count, p * pieceSize);
+                int end = std::min(count, begin + pieceSize);
+                IntroSort(data + begin, end - begin, cmp);
+            }
+        });
+
+        DynamicArray<T> buffer(count);
+        T* from = data;
+        T* to = buffer.Data();
+        for (int width = pieceSize; width < count; width *= 2) {
+            int pairs = (count + 2 * width - 1) / (2 * width);
+            int splits = std::max(1, threads / pairs);
+            pool.For(pairs * splits, 1, [&](int first, int last) {
+                for (int task = first; task < last; task++) {
+                    int pair = task / splits;
+                    int split = task % splits;
+                    int begin = pair * 2 * width;
+                    int mid = std::min(count, begin + width);
+                    int end = std::min(count, begin + 2 * width);
+
+                    T* left = from + begin;
+                    T* right = from + mid;
+                    int leftCount = mid - begin;
+                    int rightCount = end - mid;
+                    int total = leftCount + rightCount;
+                    int d0 = int((long long)total * split / splits);
+                    int d1 = int((long long)total * (split + 1) / splits);
+                    int i0 = CoRank(d0, left, leftCount, right, rightCount, cmp);
+                    int i1 = CoRank(d1, left, leftCount, right, rightCount, cmp);
+                    Merge(left + i0, i1 - i0, right + (d0 - i0), (d1 - i1) - (d0 - i0), to + begin + d0, cmp);
+                }
+            });
+            std::swap(from, to);
+        }
+
+        if (from != data) {
+            pool.For(count, MergeGrain, [&](int begin, int end) {
+                for (int i = begin; i < end; i++) data[i] = std::move(from[i]);
+            });
+        }
+    }
+
+    template <class T, class KeyFn>
+    void RadixSort(T* data, int count, KeyFn key) {
+        using Key = std::decay_t<std::invoke_result_t<KeyFn&, const T&>>;
+        static_assert(std::is_integral_v<Key>, "RadixSort needs an integral key");
+        using Bits = std::make_unsigned_t<Key>;
+        constexpr int KeyBits = int(sizeof(Bits)) * 8;
+
+        if (count < 2) return;
+
+        DynamicArray<Bits> keys(count);
+        DynamicArray<Bits> keyBuffer(count);
+        DynamicArray<T> buffer(count);
+        Bits* fromKeys = keys.Data();
+        Bits* toKeys = keyBuffer.Data();
+        T* from = data;
+        T* to = buffer.Data();
+
+        for (int i = 0; i < count; i++) {
+            Bits bits = Bits(key(data[i]));
+            if constexpr (std::is_signed_v<Key>) bits ^= Bits(Bits(1) << (KeyBits - 1));
+            fromKeys[i] = bits;
+        }
+
+        for (int shift = 0; shift < KeyBits; shift += 8) {
+            int histogram[257] = {};
+            for (int i = 0; i < count; i++) histogram[((fromKeys[i] >> shift) & 0xFF) + 1]++;
+            bool single = false;
+            for (int b = 1; b <= 256; b++) single = single || histogram[b] == count;
+            if (single) continue;
+
+            for (int b = 1; b <= 256; b++) histogram[b] += histogram[b - 1];
+            for (int i = 0; i < count; i++) {
+                int position = histogram[(fromKeys[i] >> shift) & 0xFF]++;
+                toKeys[position] = fromKeys[i];
+                to[position] = std::move(from[i]);
+            }
+            std::swap(fromKeys, toKeys);
+            std::swap(from, to);
+        }
+
+        if (from != data)
+            for (int i = 0; i < count; i++) data[i] = std::move(from[i]);
+    }
+}
\ No newline at end of file
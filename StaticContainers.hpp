@@ -0,0 +1,336 @@
+#pragma once
+
+#include <utility>
+
+#include "Stack.hpp"
+#include "Queue.hpp"
+#include "Deque.hpp"
+#include "BoundsPolicy.hpp"
+#include "Result.hpp"
+#include "error.hpp"
+
+// Fixed-capacity stack, queue and deque that keep their items inline, so
+// creating, filling and destroying one never touches the heap. All three sit
+// on RingCore, a circular buffer of N slots whose operations are constexpr and
+// can be evaluated at compile time when T is a literal type. T must be
+// default constructible; a push onto a full container throws CONTAINER_FULL.
+
+template <class T, int N, class Policy = Checked>
+class RingCore {
+private:
+    static_assert(N > 0, "RingCore needs a positive capacity");
+
+    T items[N];
+    int head;
+    int size;
+
+    static constexpr int Wrap(int index) { return index >= N ? index - N : index; }
+
+public:
+    using value_type = T;
+    static constexpr int Capacity = N;
+
+    constexpr RingCore() : items{}, head(0), size(0) {}
+
+    constexpr int GetLength() const { return size; }
+    constexpr int GetCapacity() const { return N; }
+    constexpr bool IsEmpty() const { return size == 0; }
+    constexpr bool IsFull() const { return size == N; }
+
+    constexpr T& At(int index);
+    constexpr const T& At(int index) const;
+    constexpr T& Front() { return At(0); }
+    constexpr const T& Front() const { return At(0); }
+    constexpr T& Back() { return At(size - 1); }
+    constexpr const T& Back() const { return At(size - 1); }
+
+    constexpr bool TryPushBack(const T& item);
+    constexpr bool TryPushFront(const T& item);
+    constexpr void PushBack(const T& item);
+    constexpr void PushFront(const T& item);
+    constexpr T PopBack();
+    constexpr T PopFront();
+    constexpr void Clear();
+};
+
+template <class T, int N, class Policy>
+constexpr T& RingCore<T, N, Policy>::At(int index) {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    return items[Wrap(head + index)];
+}
+
+template <class T, int N, class Policy>
+constexpr const T& RingCore<T, N, Policy>::At(int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    return items[Wrap(head + index)];
+}
+
+template <class T, int N, class Policy>
+constexpr bool RingCore<T, N, Policy>::TryPushBack(const T& item) {
+    if (size == N) return false;
+    items[Wrap(head + size)] = item;
+    size++;
+    return true;
+}
+
+template <class T, int N, class Policy>
+constexpr bool RingCore<T, N, Policy>::TryPushFront(const T& item) {
+    if (size == N) return false;
+    head = head == 0 ? N - 1 : head - 1;
+    items[head] = item;
+    size++;
+    return true;
+}
+
+template <class T, int N, class Policy>
+constexpr void RingCore<T, N, Policy>::PushBack(const T& item) {
+    if (!TryPushBack(item)) throw Errors::ContainerFull();
+}
+
+template <class T, int N, class Policy>
+constexpr void RingCore<T, N, Policy>::PushFront(const T& item) {
+    if (!TryPushFront(item)) throw Errors::ContainerFull();
+}
+
+template <class T, int N, class Policy>
+constexpr T RingCore<T, N, Policy>::PopBack() {
+    Policy::Require(size != 0, ErrorCode::EMPTY_ARRAY);
+    size--;
+    return std::move(items[Wrap(head + size)]);
+}
+
+template <class T, int N, class Policy>
+constexpr T RingCore<T, N, Policy>::PopFront() {
+    Policy::Require(size != 0, ErrorCode::EMPTY_ARRAY);
+    T item = std::move(items[head]);
+    head = Wrap(head + 1);
+    size--;
+    return item;
+}
+
+template <class T, int N, class Policy>
+constexpr void RingCore<T, N, Policy>::Clear() {
+    head = 0;
+    size = 0;
+}
+
+
+template <class T, int N, class Policy = Checked>
+class StaticStack : public Stack<T> {
+private:
+    RingCore<T, N, Policy> ring;
+
+public:
+    StaticStack() = default;
+    StaticStack(const T* items, int count);
+
+    void Push(const T& item) override { ring.PushBack(item); }
+    bool TryPush(const T& item) { return ring.TryPushBack(item); }
+    T Pop() override;
+    const T& Top() const override;
+    Result<T> TryPop() override;
+    Result<T> TryTop() const override;
+
+    T GetFirst() const override;
+    T GetLast() const override;
+    T Get(int index) const override { return ring.At(index); }
+
+    int GetLength() const override { return ring.GetLength(); }
+    int GetCapacity() const { return N; }
+    bool IsEmpty() const override { return ring.IsEmpty(); }
+    bool IsFull() const { return ring.IsFull(); }
+    void Clear() { ring.Clear(); }
+};
+
+template <class T, int N, class Policy>
+StaticStack<T, N, Policy>::StaticStack(const T* items, int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    for (int i = 0; i < count; i++) ring.PushBack(items[i]);
+}
+
+template <class T, int N, class Policy>
+T StaticStack<T, N, Policy>::Pop() {
+    if (ring.IsEmpty()) throw Errors::EmptyStackError();
+    return ring.PopBack();
+}
+
+template <class T, int N, class Policy>
+const T& StaticStack<T, N, Policy>::Top() const {
+    if (ring.IsEmpty()) throw Errors::EmptyStackError();
+    return ring.Back();
+}
+
+template <class T, int N, class Policy>
+Result<T> StaticStack<T, N, Policy>::TryPop() {
+    if (ring.IsEmpty()) return ErrorCode::EMPTY_STACK;
+    return ring.PopBack();
+}
+
+template <class T, int N, class Policy>
+Result<T> StaticStack<T, N, Policy>::TryTop() const {
+    if (ring.IsEmpty()) return ErrorCode::EMPTY_STACK;
+    return ring.Back();
+}
+
+template <class T, int N, class Policy>
+T StaticStack<T, N, Policy>::GetFirst() const {
+    if (ring.IsEmpty()) throw Errors::EmptyStackError();
+    return ring.Front();
+}
+
+template <class T, int N, class Policy>
+T StaticStack<T, N, Policy>::GetLast() const {
+    if (ring.IsEmpty()) throw Errors::EmptyStackError();
+    return ring.Back();
+}
+
+
+template <class T, int N, class Policy = Checked>
+class StaticQueue : public Queue<T> {
+private:
+    RingCore<T, N, Policy> ring;
+
+public:
+    StaticQueue() = default;
+    StaticQueue(const T* items, int count);
+
+    void Enqueue(const T& item) override { ring.PushBack(item); }
+    bool TryEnqueue(const T& item) { return ring.TryPushBack(item); }
+    T Dequeue() override;
+    const T& Peek() const override { return Front(); }
+    const T& Front() const override;
+    const T& Back() const override;
+    Result<T> TryDequeue() override;
+    Result<T> TryPeek() const override;
+
+    T GetFirst() const override { return Front(); }
+    T GetLast() const override { return Back(); }
+    T Get(int index) const override { return ring.At(index); }
+
+    int GetLength() const override { return ring.GetLength(); }
+    int GetCapacity() const { return N; }
+    bool IsEmpty() const override { return ring.IsEmpty(); }
+    bool IsFull() const { return ring.IsFull(); }
+    void Clear() { ring.Clear(); }
+};
+
+template <class T, int N, class Policy>
+StaticQueue<T, N, Policy>::StaticQueue(const T* items, int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    for (int i = 0; i < count; i++) ring.PushBack(items[i]);
+}
+
+template <class T, int N, class Policy>
+T StaticQueue<T, N, Policy>::Dequeue() {
+    if (ring.IsEmpty()) throw Errors::EmptyArray();
+    return ring.PopFront();
+}
+
+template <class T, int N, class Policy>
+const T& StaticQueue<T, N, Policy>::Front() const {
+    if (ring.IsEmpty()) throw Errors::EmptyArray();
+    return ring.Front();
+}
+
+template <class T, int N, class Policy>
+const T& StaticQueue<T, N, Policy>::Back() const {
+    if (ring.IsEmpty()) throw Errors::EmptyArray();
+    return ring.Back();
+}
+
+template <class T, int N, class Policy>
+Result<T> StaticQueue<T, N, Policy>::TryDequeue() {
+    if (ring.IsEmpty()) return ErrorCode::EMPTY_ARRAY;
+    return ring.PopFront();
+}
+
+template <class T, int N, class Policy>
+Result<T> StaticQueue<T, N, Policy>::TryPeek() const {
+    if (ring.IsEmpty()) return ErrorCode::EMPTY_ARRAY;
+    return ring.Front();
+}
+
+
+template <class T, int N, class Policy = Checked>
+class StaticDeque : public Deque<T> {
+private:
+    RingCore<T, N, Policy> ring;
+
+public:
+    StaticDeque() = default;
+    StaticDeque(const T* items, int count);
+
+    void PushFront(const T& item) override { ring.PushFront(item); }
+    void PushBack(const T& item) override { ring.PushBack(item); }
+    bool TryPushFront(const T& item) { return ring.TryPushFront(item); }
+    bool TryPushBack(const T& item) { return ring.TryPushBack(item); }
+    T PopFront() override;
+    T PopBack() override;
+    const T& Front() const override;
+    const T& Back() const override;
+    Result<T> TryPopFront() override;
+    Result<T> TryPopBack() override;
+    Result<T> TryFront() const override;
+    Result<T> TryBack() const override;
+
+    T Get(int index) const override { return ring.At(index); }
+    int GetLength() const override { return ring.GetLength(); }
+    int GetCapacity() const { return N; }
+    bool IsEmpty() const override { return ring.IsEmpty(); }
+    bool IsFull() const { return ring.IsFull(); }
+    void Clear() { ring.Clear(); }
+};
+
+template <class T, int N, class Policy>
+StaticDeque<T, N, Policy>::StaticDeque(const T* items, int count) {
+    if (count < 0) throw Errors::NegativeCount();
+    for (int i = 0; i < count; i++) ring.PushBack(items[i]);
+}
+
+template <class T, int N, class Policy>
+T StaticDeque<T, N, Policy>::PopFront() {
+    if (ring.IsEmpty()) throw Errors::EmptyArray();
+    return ring.PopFront();
+}
+
+template <class T, int N, class Policy>
+T StaticDeque<T, N, Policy>::PopBack() {
+    if (ring.IsEmpty()) throw Errors::EmptyArray();
+    return ring.PopBack();
+}
+
+template <class T, int N, class Policy>
+const T& StaticDeque<T, N, Policy>::Front() const {
+    if (ring.IsEmpty()) throw Errors::EmptyArray();
+    return ring.Front();
+}
+
+template <class T, int N, class Policy>
+const T& StaticDeque<T, N, Policy>::Back() const {
+    if (ring.IsEmpty()) throw Errors::EmptyArray();
+    return ring.Back();
+}
+
+template <class T, int N, class Policy>
+Result<T> StaticDeque<T, N, Policy>::TryPopFront() {
+    if (ring.IsEmpty()) return ErrorCode::EMPTY_ARRAY;
+    return ring.PopFront();
+}
+
+template <class T, int N, class Policy>
+Result<T> StaticDeque<T, N, Policy>::TryPopBack() {
+    if (ring.IsEmpty()) return ErrorCode::EMPTY_ARRAY;
+    return ring.PopBack();
+}
+
+template <class T, int N, class Policy>
+Result<T> StaticDeque<T, N, Policy>::TryFront() const {
+    if (ring.IsEmpty()) return ErrorCode::EMPTY_ARRAY;
+    return ring.Front();
+}
+
+template <class T, int N, class Policy>
+Result<T> StaticDeque<T, N, Policy>::TryBack() const {
+    if (ring.IsEmpty()) return ErrorCode::EMPTY_ARRAY;
+    return ring.Back();
+}
\ No newline at end of file
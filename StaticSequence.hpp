@@ -0,0 +1,401 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "ArraySequence.hpp"
+#include "LinkedList.hpp"
+#include "View.hpp"
+#include "BoundsPolicy.hpp"
+#include "Result.hpp"
+#include "error.hpp"
+
+// Statically dispatched counterparts of MutableArraySequence and
+// MutableListSequence. Every call resolves at compile time, so loops over a
+// known container type inline down to the storage access. SequenceAdapter
+// turns any of them back into a virtual Sequence<T> when type erasure is needed.
+
+template <class Derived, class T, class Policy>
+class StaticSequence {
+protected:
+    Derived& Self() { return static_cast<Derived&>(*this); }
+    const Derived& Self() const { return static_cast<const Derived&>(*this); }
+
+public:
+    using value_type = T;
+
+    bool IsEmpty() const { return Self().GetLength() == 0; }
+
+    T GetFirst() const;
+    T GetLast() const;
+
+    Result<T> TryGetFirst() const;
+    Result<T> TryGetLast() const;
+    Result<T> TryGet(int index) const;
+
+    Derived Clone() const { return Self(); }
+};
+
+template <class Derived, class T, class Policy>
+T StaticSequence<Derived, T, Policy>::GetFirst() const {
+    Policy::Require(!IsEmpty(), Derived::EmptyCode);
+    return Self().Get(0);
+}
+
+template <class Derived, class T, class Policy>
+T StaticSequence<Derived, T, Policy>::GetLast() const {
+    Policy::Require(!IsEmpty(), Derived::EmptyCode);
+    return Self().Get(Self().GetLength() - 1);
+}
+
+template <class Derived, class T, class Policy>
+Result<T> StaticSequence<Derived, T, Policy>::TryGetFirst() const {
+    if (IsEmpty()) return Derived::EmptyCode;
+    return Self().GetFirst();
+}
+
+template <class Derived, class T, class Policy>
+Result<T> StaticSequence<Derived, T, Policy>::TryGetLast() const {
+    if (IsEmpty()) return Derived::EmptyCode;
+    return Self().GetLast();
+}
+
+template <class Derived, class T, class Policy>
+Result<T> StaticSequence<Derived, T, Policy>::TryGet(int index) const {
+    if (index < 0 || index >= Self().GetLength()) return ErrorCode::INDEX_OUT_OF_RANGE;
+    return Self().Get(index);
+}
+
+
+template <class T, class Policy = Checked, class Storage = DynamicArray<T, Policy>>
+class ArrayCore : public StaticSequence<ArrayCore<T, Policy, Storage>, T, Policy> {
+private:
+    Storage items;
+    int size;
+
+public:
+    static constexpr ErrorCode EmptyCode = ErrorCode::EMPTY_ARRAY;
+
+    ArrayCore();
+    explicit ArrayCore(std::pmr::memory_resource* resource);
+    ArrayCore(const T* arr, int count, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    ArrayCore(Storage&& array);
+
+    T Get(int index) const;
+    T& At(int index);
+    const T& At(int index) const;
+    int GetLength() const;
+    T* Data() { return items.Data(); }
+    const T* Data() const { return items.Data(); }
+    std::pmr::memory_resource* GetResource() const { return items.GetResource(); }
+    void Reserve(int capacity);
+    void ShrinkToFit();
+
+    ArrayCore<T, Policy> GetSubsequence(int startIndex, int endIndex) const;
+    ArrayCore<T, Policy> Concat(const ArrayCore<T, Policy, Storage>& other) const;
+
+    ArrayCore<T, Policy, Storage>& Append(T item);
+    ArrayCore<T, Policy, Storage>& Prepend(T item);
+    ArrayCore<T, Policy, Storage>& InsertAt(T item, int index);
+    ArrayCore<T, Policy, Storage>& Remove(int index);
+
+    template <class Compare = std::less<T>>
+    void Sort(Compare cmp = Compare());
+    template <class KeyFn>
+    void SortByKey(KeyFn key);
+};
+
+template <class T, class Policy, class Storage>
+ArrayCore<T, Policy, Storage>::ArrayCore() : items(0), size(0) {}
+
+template <class T, class Policy, class Storage>
+ArrayCore<T, Policy, Storage>::ArrayCore(std::pmr::memory_resource* resource) : items(0, resource), size(0) {}
+
+template <class T, class Policy, class Storage>
+ArrayCore<T, Policy, Storage>::ArrayCore(const T* arr, int count, std::pmr::memory_resource* resource)
+    : items(arr, count, resource), size(count) {}
+
+template <class T, class Policy, class Storage>
+ArrayCore<T, Policy, Storage>::ArrayCore(Storage&& array) : items(std::move(array)), size(items.GetSize()) {}
+
+template <class T, class Policy, class Storage>
+T ArrayCore<T, Policy, Storage>::Get(int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    return items.Data()[index];
+}
+
+template <class T, class Policy, class Storage>
+T& ArrayCore<T, Policy, Storage>::At(int index) {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    return items.Data()[index];
+}
+
+template <class T, class Policy, class Storage>
+const T& ArrayCore<T, Policy, Storage>::At(int index) const {
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    return items.Data()[index];
+}
+
+template <class T, class Policy, class Storage>
+int ArrayCore<T, Policy, Storage>::GetLength() const {
+    return size;
+}
+
+template <class T, class Policy, class Storage>
+void ArrayCore<T, Policy, Storage>::Reserve(int capacity) {
+    ArrayStorage::Reserve(items, capacity);
+}
+
+template <class T, class Policy, class Storage>
+void ArrayCore<T, Policy, Storage>::ShrinkToFit() {
+    ArrayStorage::ShrinkToFit(items, size);
+}
+
+template <class T, class Policy, class Storage>
+ArrayCore<T, Policy> ArrayCore<T, Policy, Storage>::GetSubsequence(int startIndex, int endIndex) const {
+    Policy::Require(startIndex >= 0 && endIndex < size && startIndex <= endIndex, ErrorCode::INVALID_INDICES);
+    return ArrayCore<T, Policy>(items.Data() + startIndex, endIndex - startIndex + 1);
+}
+
+template <class T, class Policy, class Storage>
+ArrayCore<T, Policy> ArrayCore<T, Policy, Storage>::Concat(const ArrayCore<T, Policy, Storage>& other) const {
+    DynamicArray<T, Policy> result(size + other.size);
+    T* target = result.Data();
+    for (int i = 0; i < size; i++) target[i] = items.Data()[i];
+    for (int j = 0; j < other.size; j++) target[size + j] = other.items.Data()[j];
+    return ArrayCore<T, Policy>(std::move(result));
+}
+
+template <class T, class Policy, class Storage>
+ArrayCore<T, Policy, Storage>& ArrayCore<T, Policy, Storage>::Append(T item) {
+    ArrayStorage::InsertAt(items, size, std::move(item), size);
+    return *this;
+}
+
+template <class T, class Policy, class Storage>
+ArrayCore<T, Policy, Storage>& ArrayCore<T, Policy, Storage>::Prepend(T item) {
+    return InsertAt(std::move(item), 0);
+}
+
+template <class T, class Policy, class Storage>
+ArrayCore<T, Policy, Storage>& ArrayCore<T, Policy, Storage>::InsertAt(T item, int index) {
+    Policy::Require(index >= 0 && index <= size, ErrorCode::INDEX_OUT_OF_RANGE);
+    ArrayStorage::InsertAt(items, size, std::move(item), index);
+    return *this;
+}
+
+template <class T, class Policy, class Storage>
+ArrayCore<T, Policy, Storage>& ArrayCore<T, Policy, Storage>::Remove(int index) {
+    Policy::Require(size != 0, ErrorCode::EMPTY_ARRAY);
+    Policy::Require(index >= 0 && index < size, ErrorCode::INDEX_OUT_OF_RANGE);
+    ArrayStorage::RemoveAt(items, size, index);
+    return *this;
+}
+
+template <class T, class Policy, class Storage>
+template <class Compare>
+void ArrayCore<T, Policy, Storage>::Sort(Compare cmp) {
+    if (size >= Sorting::ParallelThreshold && DefaultPool().GetThreadCount() > 1)
+        Sorting::ParallelSort(items.Data(), size, cmp, DefaultPool());
+    else
+        Sorting::IntroSort(items.Data(), size, cmp);
+}
+
+template <class T, class Policy, class Storage>
+template <class KeyFn>
+void ArrayCore<T, Policy, Storage>::SortByKey(KeyFn key) {
+    Sorting::RadixSort(items.Data(), size, key);
+}
+
+
+template <class T, class Policy = Checked>
+class ListCore : public StaticSequence<ListCore<T, Policy>, T, Policy> {
+private:
+    LinkedList<T, Policy> list;
+
+public:
+    static constexpr ErrorCode EmptyCode = ErrorCode::EMPTY_LIST;
+
+    ListCore();
+    ListCore(T* items, int count);
+    ListCore(const LinkedList<T, Policy>& list);
+
+    T GetFirst() const;
+    T GetLast() const;
+    T Get(int index) const;
+    T& At(int index);
+    const T& At(int index) const;
+    int GetLength() const;
+
+    ListCore<T, Policy> GetSubsequence(int startIndex, int endIndex) const;
+    ListCore<T, Policy> Concat(const ListCore<T, Policy>& other) const;
+
+    ListCore<T, Policy>& Append(T item);
+    ListCore<T, Policy>& Prepend(T item);
+    ListCore<T, Policy>& InsertAt(T item, int index);
+    ListCore<T, Policy>& Remove(int index);
+};
+
+template <class T, class Policy>
+ListCore<T, Policy>::ListCore() : list() {}
+
+template <class T, class Policy>
+ListCore<T, Policy>::ListCore(T* items, int count) : list(items, count) {}
+
+template <class T, class Policy>
+ListCore<T, Policy>::ListCore(const LinkedList<T, Policy>& list) : list(list) {}
+
+template <class T, class Policy>
+T ListCore<T, Policy>::GetFirst() const {
+    return list.GetFirst();
+}
+
+template <class T, class Policy>
+T ListCore<T, Policy>::GetLast() const {
+    return list.GetLast();
+}
+
+template <class T, class Policy>
+T ListCore<T, Policy>::Get(int index) const {
+    return list.Get(index);
+}
+
+template <class T, class Policy>
+T& ListCore<T, Policy>::At(int index) {
+    return list.At(index);
+}
+
+template <class T, class Policy>
+const T& ListCore<T, Policy>::At(int index) const {
+    return list.At(index);
+}
+
+template <class T, class Policy>
+int ListCore<T, Policy>::GetLength() const {
+    return list.GetLength();
+}
+
+template <class T, class Policy>
+ListCore<T, Policy> ListCore<T, Policy>::GetSubsequence(int startIndex, int endIndex) const {
+    LinkedList<T, Policy>* sub = list.GetSubList(startIndex, endIndex);
+    ListCore<T, Policy> result(*sub);
+    delete sub;
+    return result;
+}
+
+template <class T, class Policy>
+ListCore<T, Policy> ListCore<T, Policy>::Concat(const ListCore<T, Policy>& other) const {
+    ListCore<T, Policy> result(*this);
+    other.list.ForEach([&result](const T& item) { result.list.Append(item); });
+    return result;
+}
+
+template <class T, class Policy>
+ListCore<T, Policy>& ListCore<T, Policy>::Append(T item) {
+    list.Append(item);
+    return *this;
+}
+
+template <class T, class Policy>
+ListCore<T, Policy>& ListCore<T, Policy>::Prepend(T item) {
+    list.Prepend(item);
+    return *this;
+}
+
+template <class T, class Policy>
+ListCore<T, Policy>& ListCore<T, Policy>::InsertAt(T item, int index) {
+    list.InsertAt(item, index);
+    return *this;
+}
+
+template <class T, class Policy>
+ListCore<T, Policy>& ListCore<T, Policy>::Remove(int index) {
+    list.Remove(index);
+    return *this;
+}
+
+
+// GetSubsequence and Concat wrap whatever the core returns, which is the
+// plain core (ArrayCore<T, Policy> for a CoreStack<ArrayCore<T, Policy, S>>).
+template <class Core>
+class SequenceAdapter : public Sequence<typename Core::value_type> {
+public:
+    using T = typename Core::value_type;
+
+private:
+    using Slice = std::decay_t<decltype(std::declval<const Core&>().GetSubsequence(0, 0))>;
+    using Joined = std::decay_t<decltype(std::declval<const Core&>().Concat(std::declval<const Core&>()))>;
+
+    Core core;
+
+public:
+    SequenceAdapter() = default;
+    SequenceAdapter(const Core& core) : core(core) {}
+
+    Core& Unwrap() { return core; }
+    const Core& Unwrap() const { return core; }
+
+    T GetFirst() const override { return core.GetFirst(); }
+    T GetLast() const override { return core.GetLast(); }
+    T Get(int index) const override { return core.Get(index); }
+    const T& At(int index) const override { return core.At(index); }
+    T& At(int index) { return core.At(index); }
+    Result<T> TryGetFirst() const override { return core.TryGetFirst(); }
+    Result<T> TryGetLast() const override { return core.TryGetLast(); }
+    Result<T> TryGet(int index) const override { return core.TryGet(index); }
+    int GetLength() const override { return core.GetLength(); }
+
+    Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
+    Sequence<T>* Concat(const Sequence<T>* other) const override;
+
+    Sequence<T>* Remove(int index) override;
+    Sequence<T>* Append(T item) override;
+    Sequence<T>* Prepend(T item) override;
+    Sequence<T>* InsertAt(T item, int index) override;
+
+    Sequence<T>* Instance() override { return this; }
+    Sequence<T>* Clone() const override { return new SequenceAdapter<Core>(*this); }
+};
+
+template <class Core>
+Sequence<typename Core::value_type>* SequenceAdapter<Core>::GetSubsequence(int startIndex, int endIndex) const {
+    return new SequenceAdapter<Slice>(core.GetSubsequence(startIndex, endIndex));
+}
+
+// Any other Sequence<T> is appended item by item to a copy of this one.
+template <class Core>
+Sequence<typename Core::value_type>* SequenceAdapter<Core>::Concat(const Sequence<T>* other) const {
+    if (!other) throw Errors::NullList();
+    auto otherAdapter = dynamic_cast<const SequenceAdapter<Core>*>(other);
+    if (otherAdapter) return new SequenceAdapter<Joined>(core.Concat(otherAdapter->core));
+
+    auto* result = new SequenceAdapter<Joined>(core.Concat(Core()));
+    View::From(*other).ForEach([result](const T& item) { result->Unwrap().Append(item); });
+    return result;
+}
+
+template <class Core>
+Sequence<typename Core::value_type>* SequenceAdapter<Core>::Remove(int index) {
+    core.Remove(index);
+    return this;
+}
+
+template <class Core>
+Sequence<typename Core::value_type>* SequenceAdapter<Core>::Append(T item) {
+    core.Append(item);
+    return this;
+}
+
+template <class Core>
+Sequence<typename Core::value_type>* SequenceAdapter<Core>::Prepend(T item) {
+    core.Prepend(item);
+    return this;
+}
+
+template <class Core>
+Sequence<typename Core::value_type>* SequenceAdapter<Core>::InsertAt(T item, int index) {
+    core.InsertAt(item, index);
+    return this;
+}
\ No newline at end of file
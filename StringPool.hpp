@@ -0,0 +1,123 @@
+#pragma once
+
+#include <deque>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "User.hpp"
+#include "error.hpp"
+
+// Interning pool for low-cardinality strings such as Student::group and
+// Professor::subject. Each distinct value is stored once and named by a small
+// integer id; the deque keeps stored strings at stable addresses, so the map
+// can key on views into them.
+
+class StringPool {
+private:
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, int> ids;
+
+public:
+    StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    int Intern(std::string_view value);
+    int Find(std::string_view value) const;
+    std::string_view Lookup(int id) const;
+    int GetSize() const { return static_cast<int>(strings.size()); }
+};
+
+inline int StringPool::Intern(std::string_view value) {
+    auto found = ids.find(value);
+    if (found != ids.end()) return found->second;
+
+    int id = GetSize();
+    strings.emplace_back(value);
+    ids.emplace(std::string_view(strings.back()), id);
+    return id;
+}
+
+inline int StringPool::Find(std::string_view value) const {
+    auto found = ids.find(value);
+    return found == ids.end() ? -1 : found->second;
+}
+
+inline std::string_view StringPool::Lookup(int id) const {
+    if (id < 0 || id >= GetSize()) throw Errors::IndexOutOfRange();
+    return strings[id];
+}
+
+inline StringPool& GroupPool() {
+    static StringPool pool;
+    return pool;
+}
+
+inline StringPool& SubjectPool() {
+    static StringPool pool;
+    return pool;
+}
+
+
+struct InternedStudent : public User {
+    int group;
+    bool exam_pass;
+
+    InternedStudent() : group(-1), exam_pass(false) {}
+
+    InternedStudent(const std::string& name, int age, int id, std::string_view group_, bool pass)
+        : User(name, age, id), group(GroupPool().Intern(group_)), exam_pass(pass) {
+    }
+
+    explicit InternedStudent(const Student& student)
+        : InternedStudent(student.name, student.age, student.id, student.group, student.exam_pass) {
+    }
+
+    std::string_view Group() const { return GroupPool().Lookup(group); }
+
+    Student ToStudent() const {
+        return Student(name, age, id, std::string(Group()), exam_pass);
+    }
+
+    bool operator==(const InternedStudent& other) const {
+        return group == other.group && exam_pass == other.exam_pass &&
+            static_cast<const User&>(*this) == static_cast<const User&>(other);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const InternedStudent& student) {
+        return os << student.ToStudent();
+    }
+};
+
+
+struct InternedProfessor : public User {
+    int subject;
+    bool be_on_exam;
+
+    InternedProfessor() : subject(-1), be_on_exam(false) {}
+
+    InternedProfessor(const std::string& name, int age, int id, std::string_view subject_, bool pass)
+        : User(name, age, id), subject(SubjectPool().Intern(subject_)), be_on_exam(pass) {
+    }
+
+    explicit InternedProfessor(const Professor& teacher)
+        : InternedProfessor(teacher.name, teacher.age, teacher.id, teacher.subject, teacher.be_on_exam) {
+    }
+
+    std::string_view Subject() const { return SubjectPool().Lookup(subject); }
+
+    Professor ToProfessor() const {
+        return Professor(name, age, id, std::string(Subject()), be_on_exam);
+    }
+
+    bool operator==(const InternedProfessor& other) const {
+        return subject == other.subject && be_on_exam == other.be_on_exam &&
+            static_cast<const User&>(*this) == static_cast<const User&>(other);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const InternedProfessor& teacher) {
+        return os << teacher.ToProfessor();
+    }
+};
\ No newline at end of file
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "DynamicArray.hpp"
+#include "ArraySequence.hpp"
+#include "Sequence.hpp"
+#include "User.hpp"
+#include "StringPool.hpp"
+#include "error.hpp"
+
+// Columnar storage for User/Student records: every field lives in its own
+// DynamicArray, and exam_pass is packed into a bitmap, so scans over one
+// field touch only that field's memory. Groups are stored as GroupPool() ids.
+
+inline int PopCount(std::uint64_t word) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+    for (; word != 0; word &= word - 1) count++;
+    return count;
+#endif
+}
+
+inline int LowestBit(std::uint64_t word) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    while ((word & 1) == 0) { word >>= 1; bit++; }
+    return bit;
+#endif
+}
+
+class UserTable {
+protected:
+    int size;
+    int capacity;
+
+    DynamicArray<std::string> names;
+    DynamicArray<int> ages;
+    DynamicArray<int> ids;
+
+    virtual void ResizeColumns(int newCapacity);
+    void Grow();
+
+public:
+    UserTable();
+    virtual ~UserTable() = default;
+
+    int GetLength() const { return size; }
+    void Reserve(int newCapacity);
+
+    void Append(const User& user);
+    User GetRow(int index) const;
+    void SetRow(int index, const User& user);
+
+    const std::string& Name(int index) const;
+    int Age(int index) const;
+    int Id(int index) const;
+
+    const int* Ages() const { return ages.Data(); }
+    const int* Ids() const { return ids.Data(); }
+
+    int FindId(int id) const;
+
+    template <class F>
+    MutableArraySequence<int> WhereAge(F predicate) const;
+};
+
+inline UserTable::UserTable() : size(0), capacity(0), names(0), ages(0), ids(0) {}
+
+inline void UserTable::ResizeColumns(int newCapacity) {
+    names.Resize(newCapacity);
+    ages.Resize(newCapacity);
+    ids.Resize(newCapacity);
+    capacity = newCapacity;
+}
+
+inline void UserTable::Grow() {
+    if (size + 1 > capacity) ResizeColumns(capacity == 0 ? 16 : capacity + capacity / 2 + 1);
+}
+
+inline void UserTable::Reserve(int newCapacity) {
+    if (newCapacity < 0) throw Errors::NegativeSize();
+    if (newCapacity > capacity) ResizeColumns(newCapacity);
+}
+
+inline void UserTable::Append(const User& user) {
+    Grow();
+    names.Data()[size] = user.name;
+    ages.Data()[size] = user.age;
+    ids.Data()[size] = user.id;
+    size++;
+}
+
+inline User UserTable::GetRow(int index) const {
+    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
+    return User(names.Data()[index], ages.Data()[index], ids.Data()[index]);
+}
+
+inline void UserTable::SetRow(int index, const User& user) {
+    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
+    names.Data()[index] = user.name;
+    ages.Data()[index] = user.age;
+    ids.Data()[index] = user.id;
+}
+
+inline const std::string& UserTable::Name(int index) const {
+    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
+    return names.Data()[index];
+}
+
+inline int UserTable::Age(int index) const {
+    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
+    return ages.Data()[index];
+}
+
+inline int UserTable::Id(int index) const {
+    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
+    return ids.Data()[index];
+}
+
+inline int UserTable::FindId(int id) const {
+    const int* column = ids.Data();
+    for (int i = 0; i < size; i++)
+        if (column[i] == id) return i;
+    return -1;
+}
+
+template <class F>
+MutableArraySequence<int> UserTable::WhereAge(F predicate) const {
+    MutableArraySequence<int> rows;
+    const int* column = ages.Data();
+    for (int i = 0; i < size; i++)
+        if (predicate(column[i])) rows.Append(i);
+    return rows;
+}
+
+
+class StudentTable : public UserTable {
+protected:
+    DynamicArray<int> groups;
+    DynamicArray<std::uint64_t> passBits;
+
+    void ResizeColumns(int newCapacity) override;
+
+public:
+    StudentTable();
+    StudentTable(const Sequence<Student>& students);
+
+    void Append(const Student& student);
+    void Append(const InternedStudent& student);
+    Student GetRow(int index) const;
+    InternedStudent GetInternedRow(int index) const;
+    void SetRow(int index, const Student& student);
+
+    std::string_view Group(int index) const;
+    int GroupId(int index) const;
+    const int* GroupIds() const { return groups.Data(); }
+    bool ExamPass(int index) const;
+    void SetExamPass(int index, bool pass);
+
+    int CountPassed() const;
+    MutableArraySequence<int> PassedRows() const;
+    MutableArraySequence<int> PassedRowsInGroup(std::string_view group) const;
+    DynamicArray<int> CountPassedByGroup() const;
+
+    MutableArraySequence<Student> ToSequence() const;
+};
+
+inline StudentTable::StudentTable() : UserTable(), groups(0), passBits(0) {}
+
+inline StudentTable::StudentTable(const Sequence<Student>& students) : StudentTable() {
+    Reserve(students.GetLength());
+    for (int i = 0; i < students.GetLength(); i++) Append(students.At(i));
+}
+
+inline void StudentTable::ResizeColumns(int newCapacity) {
+    int oldWords = passBits.GetSize();
+    int newWords = (newCapacity + 63) / 64;
+    UserTable::ResizeColumns(newCapacity);
+    groups.Resize(newCapacity);
+    passBits.Resize(newWords);
+    for (int w = oldWords; w < newWords; w++) passBits.Data()[w] = 0;
+}
+
+inline void StudentTable::Append(const Student& student) {
+    UserTable::Append(student);
+    groups.Data()[size - 1] = GroupPool().Intern(student.group);
+    SetExamPass(size - 1, student.exam_pass);
+}
+
+inline void StudentTable::Append(const InternedStudent& student) {
+    UserTable::Append(student);
+    groups.Data()[size - 1] = student.group;
+    SetExamPass(size - 1, student.exam_pass);
+}
+
+inline Student StudentTable::GetRow(int index) const {
+    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
+    return Student(names.Data()[index], ages.Data()[index], ids.Data()[index], std::string(Group(index)), ExamPass(index));
+}
+
+inline InternedStudent StudentTable::GetInternedRow(int index) const {
+    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
+    InternedStudent student;
+    student.name = names.Data()[index];
+    student.age = ages.Data()[index];
+    student.id = ids.Data()[index];
+    student.group = groups.Data()[index];
+    student.exam_pass = ExamPass(index);
+    return student;
+}
+
+inline void StudentTable::SetRow(int index, const Student& student) {
+    UserTable::SetRow(index, student);
+    groups.Data()[index] = GroupPool().Intern(student.group);
+    SetExamPass(index, student.exam_pass);
+}
+
+inline std::string_view StudentTable::Group(int index) const {
+    return GroupPool().Lookup(GroupId(index));
+}
+
+inline int StudentTable::GroupId(int index) const {
+    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
+    return groups.Data()[index];
+}
+
+inline bool StudentTable::ExamPass(int index) const {
+    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
+    return (passBits.Data()[index / 64] >> (index % 64)) & 1;
+}
+
+inline void StudentTable::SetExamPass(int index, bool pass) {
+    if (index < 0 || index >= size) throw Errors::IndexOutOfRange();
+    std::uint64_t mask = std::uint64_t(1) << (index % 64);
+    if (pass) passBits.Data()[index / 64] |= mask;
+    else passBits.Data()[index / 64] &= ~mask;
+}
+
+inline int StudentTable::CountPassed() const {
+    int count = 0;
+    const std::uint64_t* bits = passBits.Data();
+    for (int w = 0; w < (size + 63) / 64; w++) count += PopCount(bits[w]);
+    return count;
+}
+
+inline MutableArraySequence<int> StudentTable::PassedRows() const {
+    MutableArraySequence<int> rows;
+    const std::uint64_t* bits = passBits.Data();
+    for (int w = 0; w < (size + 63) / 64; w++) {
+        for (std::uint64_t word = bits[w]; word != 0; word &= word - 1)
+            rows.Append(w * 64 + LowestBit(word));
+    }
+    return rows;
+}
+
+inline MutableArraySequence<int> StudentTable::PassedRowsInGroup(std::string_view group) const {
+    MutableArraySequence<int> rows;
+    int groupId = GroupPool().Find(group);
+    if (groupId < 0) return rows;
+
+    const std::uint64_t* bits = passBits.Data();
+    const int* column = groups.Data();
+    for (int w = 0; w < (size + 63) / 64; w++) {
+        for (std::uint64_t word = bits[w]; word != 0; word &= word - 1) {
+            int row = w * 64 + LowestBit(word);
+            if (column[row] == groupId) rows.Append(row);
+        }
+    }
+    return rows;
+}
+
+inline DynamicArray<int> StudentTable::CountPassedByGroup() const {
+    DynamicArray<int> counts(GroupPool().GetSize());
+    int* target = counts.Data();
+    for (int g = 0; g < counts.GetSize(); g++) target[g] = 0;
+
+    const std::uint64_t* bits = passBits.Data();
+    const int* column = groups.Data();
+    for (int w = 0; w < (size + 63) / 64; w++) {
+        for (std::uint64_t word = bits[w]; word != 0; word &= word - 1)
+            target[column[w * 64 + LowestBit(word)]]++;
+    }
+    return counts;
+}
+
+inline MutableArraySequence<Student> StudentTable::ToSequence() const {
+    MutableArraySequence<Student> result;
+    for (int i = 0; i < size; i++) result.Append(GetRow(i));
+    return result;
+}
\ No newline at end of file
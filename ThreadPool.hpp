@@ -0,0 +1,133 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads shared by the Parallel:: algorithms. A pool of
+// N threads starts N - 1 workers; the thread calling For() takes chunks too,
+// so ThreadPool(1) runs everything on the caller.
+
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping;
+
+    void Work();
+
+public:
+    explicit ThreadPool(int threads = static_cast<int>(std::thread::hardware_concurrency()));
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int GetThreadCount() const { return static_cast<int>(workers.size()) + 1; }
+
+    void Submit(std::function<void()> task);
+
+    template <class F>
+    void For(int count, int grain, F body);
+};
+
+inline ThreadPool::ThreadPool(int threads) : stopping(false) {
+    if (threads < 1) threads = 1;
+    for (int i = 1; i < threads; i++)
+        workers.emplace_back([this] { Work(); });
+}
+
+inline ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) worker.join();
+}
+
+inline void ThreadPool::Work() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || !tasks.empty(); });
+            if (tasks.empty()) return;
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        task();
+    }
+}
+
+inline void ThreadPool::Submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push(std::move(task));
+    }
+    wake.notify_one();
+}
+
+// Calls body(begin, end) over [0, count) split into chunks of at least
+// `grain` items and returns once every chunk has run. The first exception
+// thrown by a chunk is rethrown on the calling thread.
+template <class F>
+void ThreadPool::For(int count, int grain, F body) {
+    if (count <= 0) return;
+    if (grain < 1) grain = 1;
+
+    int chunks = std::min((count + grain - 1) / grain, GetThreadCount() * 4);
+    if (chunks <= 1 || workers.empty()) {
+        body(0, count);
+        return;
+    }
+
+    int chunkSize = (count + chunks - 1) / chunks;
+    std::atomic<int> next(0);
+    std::exception_ptr error;
+    std::mutex doneMutex;
+    std::condition_variable doneWake;
+    int helpers = std::min(static_cast<int>(workers.size()), chunks - 1);
+    int running = helpers;
+
+    auto drain = [&] {
+        for (int chunk = next++; chunk < chunks; chunk = next++) {
+            int begin = chunk * chunkSize;
+            int end = std::min(count, begin + chunkSize);
+            if (begin >= end) continue;
+            try {
+                body(begin, end);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(doneMutex);
+                if (!error) error = std::current_exception();
+            }
+        }
+    };
+
+    for (int i = 0; i < helpers; i++) {
+        Submit([&] {
+            drain();
+            std::lock_guard<std::mutex> lock(doneMutex);
+            if (--running == 0) doneWake.notify_one();
+        });
+    }
+
+    drain();
+    std::unique_lock<std::mutex> lock(doneMutex);
+    doneWake.wait(lock, [&] { return running == 0; });
+    if (error) std::rethrow_exception(error);
+}
+
+inline ThreadPool& DefaultPool() {
+    static ThreadPool pool;
+    return pool;
+}
\ No newline at end of file
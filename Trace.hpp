@@ -0,0 +1,472 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <random>
+#include <string>
+#include <type_traits>
+
+#include "error.hpp"
+#include "DynamicArray.hpp"
+#include "ArraySequence.hpp"
+#include "Stack.hpp"
+#include "Queue.hpp"
+#include "Deque.hpp"
+#include "MemoryResource.hpp"
+#include "Serialize.hpp"
+#include "Sort.hpp"
+
+// Workload traces for stacks, queues and deques. RecordingStack/Queue/Deque
+// wrap a live structure and log every operation to a TraceWriter; a trace can
+// also be generated with GenerateTrace (Zipf-sized bursts of arrivals and
+// drains). Replay runs a trace against any implementation and reports
+// throughput, per-operation latency percentiles and, when the target
+// allocates from a CountingResource, peak memory.
+//
+// File format: an 8-byte header (magic "SEQT", version, structure kind, item
+// size) followed by one byte per operation, plus the raw item for inserts,
+// and a closing End byte. Items must be trivially copyable.
+
+namespace Tracing {
+
+    enum class TraceKind : std::uint8_t { STACK = 1, QUEUE, DEQUE };
+
+    enum class TraceOp : std::uint8_t {
+        End = 0,
+        Push, Pop, Top,
+        Enqueue, Dequeue, Front, Back,
+        PushFront, PushBack, PopFront, PopBack
+    };
+
+    inline bool Inserts(TraceOp op) {
+        return op == TraceOp::Push || op == TraceOp::Enqueue || op == TraceOp::PushFront || op == TraceOp::PushBack;
+    }
+
+    struct TraceHeader {
+        char magic[4];
+        std::uint16_t version;
+        TraceKind kind;
+        std::uint8_t itemSize;
+    };
+    static_assert(sizeof(TraceHeader) == 8);
+
+    constexpr char TraceMagic[4] = { 'S', 'E', 'Q', 'T' };
+    constexpr std::uint16_t TraceVersion = 1;
+
+    template <class T>
+    struct TraceEvent {
+        TraceOp op;
+        T item;
+    };
+
+    template <class T>
+    struct Trace {
+        static_assert(std::is_trivially_copyable_v<T>, "trace items are stored as raw bytes");
+
+        TraceKind kind = TraceKind::QUEUE;
+        MutableArraySequence<TraceEvent<T>> events;
+    };
+
+
+    template <class T>
+    class TraceWriter {
+        static_assert(std::is_trivially_copyable_v<T>, "trace items are stored as raw bytes");
+
+    private:
+        Serialization::BinaryWriter writer;
+        TraceKind kind;
+        long long recorded;
+        bool finished;
+
+    public:
+        TraceWriter(std::ostream& out, TraceKind kind);
+        TraceWriter(const TraceWriter&) = delete;
+        TraceWriter& operator=(const TraceWriter&) = delete;
+        ~TraceWriter();
+
+        TraceKind GetKind() const { return kind; }
+        long long GetRecorded() const { return recorded; }
+
+        void Record(TraceOp op);
+        void Record(TraceOp op, const T& item);
+        // Writes the End marker and flushes; throws on write errors.
+        void Finish();
+    };
+
+    template <class T>
+    TraceWriter<T>::TraceWriter(std::ostream& out, TraceKind kind) : writer(out), kind(kind), recorded(0), finished(false) {
+        TraceHeader header{};
+        std::memcpy(header.magic, TraceMagic, sizeof(TraceMagic));
+        header.version = TraceVersion;
+        header.kind = kind;
+        header.itemSize = std::uint8_t(sizeof(T));
+        writer.WriteBytes(&header, sizeof(header));
+    }
+
+    template <class T>
+    TraceWriter<T>::~TraceWriter() {
+        if (finished) return;
+        try {
+            TraceOp end = TraceOp::End;
+            writer.WriteBytes(&end, 1);
+        }
+        catch (...) {}
+    }
+
+    template <class T>
+    void TraceWriter<T>::Record(TraceOp op) {
+        writer.WriteBytes(&op, 1);
+        recorded++;
+    }
+
+    template <class T>
+    void TraceWriter<T>::Record(TraceOp op, const T& item) {
+        writer.WriteBytes(&op, 1);
+        writer.WriteBytes(&item, sizeof(T));
+        recorded++;
+    }
+
+    template <class T>
+    void TraceWriter<T>::Finish() {
+        if (finished) return;
+        TraceOp end = TraceOp::End;
+        writer.WriteBytes(&end, 1);
+        writer.Flush();
+        finished = true;
+    }
+
+    template <class T>
+    void WriteTrace(std::ostream& out, const Trace<T>& trace) {
+        TraceWriter<T> writer(out, trace.kind);
+        for (int i = 0; i < trace.events.GetLength(); i++) {
+            const TraceEvent<T>& event = trace.events.At(i);
+            if (Inserts(event.op)) writer.Record(event.op, event.item);
+            else writer.Record(event.op);
+        }
+        writer.Finish();
+    }
+
+    template <class T>
+    Trace<T> ReadTrace(std::istream& in) {
+        Serialization::BinaryReader reader(in);
+        TraceHeader header;
+        reader.ReadBytes(&header, sizeof(header));
+        if (std::memcmp(header.magic, TraceMagic, sizeof(TraceMagic)) != 0) throw Errors::InvalidArgument("not a trace file");
+        if (header.version != TraceVersion) throw Errors::InvalidArgument("unsupported trace version");
+        if (header.itemSize != sizeof(T)) throw Errors::InvalidArgument("trace item size mismatch");
+        if (header.kind < TraceKind::STACK || header.kind > TraceKind::DEQUE) throw Errors::InvalidArgument("unknown trace kind");
+
+        Trace<T> trace;
+        trace.kind = header.kind;
+        for (;;) {
+            TraceEvent<T> event{};
+            reader.ReadBytes(&event.op, 1);
+            if (event.op == TraceOp::End) break;
+            if (event.op > TraceOp::PopBack) throw Errors::InvalidArgument("unknown trace operation");
+            if (Inserts(event.op)) reader.ReadBytes(&event.item, sizeof(T));
+            trace.events.Append(event);
+        }
+        return trace;
+    }
+
+    template <class T>
+    void SaveTrace(const std::string& path, const Trace<T>& trace) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw Errors::IoError("cannot open " + path);
+        WriteTrace(out, trace);
+    }
+
+    template <class T>
+    Trace<T> LoadTrace(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw Errors::IoError("cannot open " + path);
+        return ReadTrace<T>(in);
+    }
+
+
+    // Decorators: every call is logged, then forwarded. Get/GetLength/IsEmpty
+    // are inspection, not workload, and are not logged.
+    template <class T>
+    class RecordingStack : public Stack<T> {
+    private:
+        Stack<T>& inner;
+        TraceWriter<T>& trace;
+
+    public:
+        RecordingStack(Stack<T>& inner, TraceWriter<T>& trace) : inner(inner), trace(trace) {
+            if (trace.GetKind() != TraceKind::STACK) throw Errors::IncompatibleTypes();
+        }
+
+        void Push(const T& item) override { trace.Record(TraceOp::Push, item); inner.Push(item); }
+        T Pop() override { trace.Record(TraceOp::Pop); return inner.Pop(); }
+        const T& Top() const override { trace.Record(TraceOp::Top); return inner.Top(); }
+        Result<T> TryPop() override { trace.Record(TraceOp::Pop); return inner.TryPop(); }
+        Result<T> TryTop() const override { trace.Record(TraceOp::Top); return inner.TryTop(); }
+
+        T GetFirst() const override { return inner.GetFirst(); }
+        T GetLast() const override { return inner.GetLast(); }
+        T Get(int index) const override { return inner.Get(index); }
+        int GetLength() const override { return inner.GetLength(); }
+        bool IsEmpty() const override { return inner.IsEmpty(); }
+    };
+
+    template <class T>
+    class RecordingQueue : public Queue<T> {
+    private:
+        Queue<T>& inner;
+        TraceWriter<T>& trace;
+
+    public:
+        RecordingQueue(Queue<T>& inner, TraceWriter<T>& trace) : inner(inner), trace(trace) {
+            if (trace.GetKind() != TraceKind::QUEUE) throw Errors::IncompatibleTypes();
+        }
+
+        void Enqueue(const T& item) override { trace.Record(TraceOp::Enqueue, item); inner.Enqueue(item); }
+        T Dequeue() override { trace.Record(TraceOp::Dequeue); return inner.Dequeue(); }
+        const T& Peek() const override { trace.Record(TraceOp::Front); return inner.Peek(); }
+        const T& Front() const override { trace.Record(TraceOp::Front); return inner.Front(); }
+        const T& Back() const override { trace.Record(TraceOp::Back); return inner.Back(); }
+        Result<T> TryDequeue() override { trace.Record(TraceOp::Dequeue); return inner.TryDequeue(); }
+        Result<T> TryPeek() const override { trace.Record(TraceOp::Front); return inner.TryPeek(); }
+
+        T GetFirst() const override { return inner.GetFirst(); }
+        T GetLast() const override { return inner.GetLast(); }
+        T Get(int index) const override { return inner.Get(index); }
+        int GetLength() const override { return inner.GetLength(); }
+        bool IsEmpty() const override { return inner.IsEmpty(); }
+    };
+
+    template <class T>
+    class RecordingDeque : public Deque<T> {
+    private:
+        Deque<T>& inner;
+        TraceWriter<T>& trace;
+
+    public:
+        RecordingDeque(Deque<T>& inner, TraceWriter<T>& trace) : inner(inner), trace(trace) {
+            if (trace.GetKind() != TraceKind::DEQUE) throw Errors::IncompatibleTypes();
+        }
+
+        void PushFront(const T& item) override { trace.Record(TraceOp::PushFront, item); inner.PushFront(item); }
+        void PushBack(const T& item) override { trace.Record(TraceOp::PushBack, item); inner.PushBack(item); }
+        T PopFront() override { trace.Record(TraceOp::PopFront); return inner.PopFront(); }
+        T PopBack() override { trace.Record(TraceOp::PopBack); return inner.PopBack(); }
+        const T& Front() const override { trace.Record(TraceOp::Front); return inner.Front(); }
+        const T& Back() const override { trace.Record(TraceOp::Back); return inner.Back(); }
+        Result<T> TryPopFront() override { trace.Record(TraceOp::PopFront); return inner.TryPopFront(); }
+        Result<T> TryPopBack() override { trace.Record(TraceOp::PopBack); return inner.TryPopBack(); }
+        Result<T> TryFront() const override { trace.Record(TraceOp::Front); return inner.TryFront(); }
+        Result<T> TryBack() const override { trace.Record(TraceOp::Back); return inner.TryBack(); }
+
+        T Get(int index) const override { return inner.Get(index); }
+        int GetLength() const override { return inner.GetLength(); }
+        bool IsEmpty() const override { return inner.IsEmpty(); }
+    };
+
+
+    struct ReplayReport {
+        long long operations = 0;
+        long long failures = 0;
+        long long checksum = 0;
+        double totalMs = 0;
+        double opsPerSecond = 0;
+        double p50Ns = 0, p90Ns = 0, p99Ns = 0, p999Ns = 0, maxNs = 0;
+        std::size_t peakBytes = 0;
+        std::size_t allocations = 0;
+    };
+
+    // Runs apply(event) for every event, timing each one. Operations that
+    // throw (a pop on an empty structure) count as failures. The checksum
+    // adds up every value read back, so backends can be checked against each
+    // other.
+    template <class T, class Apply>
+    ReplayReport ReplayEvents(const Trace<T>& trace, Apply apply, CountingResource* memory) {
+        ReplayReport report;
+        int count = trace.events.GetLength();
+        DynamicArray<long long> latencies(count);
+        std::size_t allocationsBefore = 0;
+        if (memory != nullptr) {
+            memory->ResetPeak();
+            allocationsBefore = memory->GetAllocationCount();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; i++) {
+            auto t1 = std::chrono::steady_clock::now();
+            try {
+                report.checksum += apply(trace.events.At(i));
+            }
+            catch (const std::exception&) {
+                report.failures++;
+            }
+            auto t2 = std::chrono::steady_clock::now();
+            latencies[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+        }
+        auto finish = std::chrono::steady_clock::now();
+
+        report.operations = count;
+        report.totalMs = std::chrono::duration<double, std::milli>(finish - start).count();
+        report.opsPerSecond = report.totalMs > 0 ? count / (report.totalMs / 1000.0) : 0;
+        if (count > 0) {
+            Sorting::IntroSort(latencies.Data(), count, std::less<long long>());
+            auto at = [&latencies, count](double q) { return double(latencies[std::min(count - 1, int(q * count))]); };
+            report.p50Ns = at(0.5);
+            report.p90Ns = at(0.9);
+            report.p99Ns = at(0.99);
+            report.p999Ns = at(0.999);
+            report.maxNs = double(latencies[count - 1]);
+        }
+        if (memory != nullptr) {
+            report.peakBytes = memory->GetPeakBytes();
+            report.allocations = memory->GetAllocationCount() - allocationsBefore;
+        }
+        return report;
+    }
+
+    template <class T>
+    long long ChecksumOf(const T& item) {
+        if constexpr (std::is_arithmetic_v<T>) return static_cast<long long>(item);
+        else return 0;
+    }
+
+    template <class T>
+    ReplayReport Replay(const Trace<T>& trace, Stack<T>& target, CountingResource* memory = nullptr) {
+        if (trace.kind != TraceKind::STACK) throw Errors::IncompatibleTypes();
+        return ReplayEvents(trace, [&target](const TraceEvent<T>& event) -> long long {
+            switch (event.op) {
+            case TraceOp::Push: target.Push(event.item); return 0;
+            case TraceOp::Pop: return ChecksumOf(target.Pop());
+            default: return ChecksumOf(target.Top());
+            }
+        }, memory);
+    }
+
+    template <class T>
+    ReplayReport Replay(const Trace<T>& trace, Queue<T>& target, CountingResource* memory = nullptr) {
+        if (trace.kind != TraceKind::QUEUE) throw Errors::IncompatibleTypes();
+        return ReplayEvents(trace, [&target](const TraceEvent<T>& event) -> long long {
+            switch (event.op) {
+            case TraceOp::Enqueue: target.Enqueue(event.item); return 0;
+            case TraceOp::Dequeue: return ChecksumOf(target.Dequeue());
+            case TraceOp::Back: return ChecksumOf(target.Back());
+            default: return ChecksumOf(target.Front());
+            }
+        }, memory);
+    }
+
+    template <class T>
+    ReplayReport Replay(const Trace<T>& trace, Deque<T>& target, CountingResource* memory = nullptr) {
+        if (trace.kind != TraceKind::DEQUE) throw Errors::IncompatibleTypes();
+        return ReplayEvents(trace, [&target](const TraceEvent<T>& event) -> long long {
+            switch (event.op) {
+            case TraceOp::PushFront: target.PushFront(event.item); return 0;
+            case TraceOp::PushBack: target.PushBack(event.item); return 0;
+            case TraceOp::PopFront: return ChecksumOf(target.PopFront());
+            case TraceOp::PopBack: return ChecksumOf(target.PopBack());
+            case TraceOp::Back: return ChecksumOf(target.Back());
+            default: return ChecksumOf(target.Front());
+            }
+        }, memory);
+    }
+
+    inline void PrintReport(const ReplayReport& report, std::ostream& out) {
+        out << report.operations << " ops (" << report.failures << " failed) in " << report.totalMs << " ms, "
+            << report.opsPerSecond / 1e6 << " Mops/s\n"
+            << "latency ns p50 " << report.p50Ns << ", p90 " << report.p90Ns << ", p99 " << report.p99Ns
+            << ", p99.9 " << report.p999Ns << ", max " << report.maxNs << "\n"
+            << "peak memory " << report.peakBytes << " bytes in " << report.allocations << " allocations, checksum "
+            << report.checksum << "\n";
+    }
+
+
+    struct GeneratorOptions {
+        int operations = 1000000;
+        // Burst lengths follow P(k) ~ 1 / k^zipfExponent on 1..maxBurst.
+        double zipfExponent = 1.2;
+        int maxBurst = 4096;
+        // Chance of a read (Top/Front/Back) after each insert or removal.
+        double readRatio = 0.1;
+        unsigned seed = 42;
+    };
+
+    class ZipfDistribution {
+    private:
+        DynamicArray<double> cdf;
+
+    public:
+        ZipfDistribution(int maxValue, double exponent);
+
+        template <class Random>
+        int operator()(Random& random);
+    };
+
+    inline ZipfDistribution::ZipfDistribution(int maxValue, double exponent) : cdf(maxValue) {
+        double total = 0;
+        for (int k = 1; k <= maxValue; k++) {
+            total += 1.0 / std::pow(double(k), exponent);
+            cdf[k - 1] = total;
+        }
+        for (int k = 0; k < maxValue; k++) cdf[k] /= total;
+    }
+
+    template <class Random>
+    int ZipfDistribution::operator()(Random& random) {
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(random);
+        int low = 0, high = cdf.GetSize() - 1;
+        while (low < high) {
+            int middle = (low + high) / 2;
+            if (cdf[middle] < u) low = middle + 1;
+            else high = middle;
+        }
+        return low + 1;
+    }
+
+    // Alternates arrival bursts and drains, both Zipf-sized, so the structure
+    // mostly stays small but now and then grows by thousands of items. Drains
+    // never remove more than is there, so a replay has no failures. Items are
+    // T(0), T(1), ... in arrival order. A deque burst works one end, picked
+    // at random for each burst.
+    template <class T>
+    Trace<T> GenerateTrace(TraceKind kind, const GeneratorOptions& options = {}) {
+        Trace<T> trace;
+        trace.kind = kind;
+        trace.events.Reserve(options.operations);
+
+        std::mt19937 random(options.seed);
+        ZipfDistribution burst(options.maxBurst, options.zipfExponent);
+        std::bernoulli_distribution read(options.readRatio);
+        std::bernoulli_distribution front(0.5);
+
+        TraceOp insert = kind == TraceKind::STACK ? TraceOp::Push : kind == TraceKind::QUEUE ? TraceOp::Enqueue : TraceOp::PushBack;
+        TraceOp remove = kind == TraceKind::STACK ? TraceOp::Pop : kind == TraceKind::QUEUE ? TraceOp::Dequeue : TraceOp::PopFront;
+        TraceOp peek = kind == TraceKind::STACK ? TraceOp::Top : TraceOp::Front;
+
+        int size = 0;
+        long long next = 0;
+        auto add = [&trace](TraceOp op, T item) { trace.events.Append(TraceEvent<T>{ op, item }); };
+        auto full = [&trace, &options] { return trace.events.GetLength() >= options.operations; };
+
+        while (!full()) {
+            TraceOp op = kind == TraceKind::DEQUE && front(random) ? TraceOp::PushFront : insert;
+            for (int n = burst(random); n > 0 && !full(); n--) {
+                add(op, T(next++));
+                size++;
+                if (read(random) && !full()) add(peek, T());
+            }
+            op = kind == TraceKind::DEQUE && front(random) ? TraceOp::PopBack : remove;
+            for (int n = burst(random); n > 0 && size > 0 && !full(); n--) {
+                add(op, T());
+                size--;
+                if (size > 0 && read(random) && !full()) add(kind == TraceKind::QUEUE ? TraceOp::Back : peek, T());
+            }
+        }
+        return trace;
+    }
+}
\ No newline at end of file
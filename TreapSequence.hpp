@@ -0,0 +1,483 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include "Sequence.hpp"
+#include "BoundsPolicy.hpp"
+#include "Result.hpp"
+#include "error.hpp"
+
+// Sequence stored as an implicit treap: nodes are ordered by position, not by
+// key, and every node remembers the item count of its subtree, so Get,
+// InsertAt and Remove descend in O(log n). Each node holds a chunk of up to
+// ChunkCapacity neighbouring items, which keeps scans and small edits inside
+// one cache-friendly block. SplitAt and ConcatInPlace move whole subtrees in
+// O(log n). The const Sequence<T> operations copy, as the interface requires:
+// GetSubsequence copies only the requested k items, O(k + log n), while
+// Concat copies both operands in one pass, O(n + m), because the result may
+// not share nodes with sequences that stay mutable.
+
+template <class T, class Policy = Checked>
+class TreapSequence : public Sequence<T> {
+public:
+    static constexpr int ChunkCapacity = std::max(8, std::min(256, int(1024 / sizeof(T))));
+
+private:
+    struct Node {
+        T items[ChunkCapacity];
+        int count;
+        int total;
+        unsigned priority;
+        Node* left;
+        Node* right;
+
+        explicit Node(unsigned priority) : count(0), total(0), priority(priority), left(nullptr), right(nullptr) {}
+    };
+
+    Node* root;
+    unsigned seed;
+
+    static int Total(const Node* node) { return node ? node->total : 0; }
+    static void Update(Node* node);
+    static Node* Merge(Node* left, Node* right);
+    static std::pair<Node*, Node*> Split(Node* node, int index, unsigned priority);
+    static Node* Copy(const Node* node);
+    static Node* CopyRange(const Node* node, int first, int last);
+    static int Height(const Node* node);
+    static void Erase(Node* node);
+    template <class F>
+    static void Visit(const Node* node, F& visit);
+
+    static unsigned NewSeed();
+    unsigned NextPriority();
+    Node* Locate(int index, int& offset) const;
+    void SplitChunk(int index);
+
+public:
+    TreapSequence();
+    TreapSequence(T* items, int count);
+    TreapSequence(const TreapSequence<T, Policy>& other);
+    ~TreapSequence() override;
+
+    TreapSequence<T, Policy>& operator=(const TreapSequence<T, Policy>& other);
+
+    T GetFirst() const override;
+    T GetLast() const override;
+    T Get(int index) const override;
+    Result<T> TryGetFirst() const override;
+    Result<T> TryGetLast() const override;
+    Result<T> TryGet(int index) const override;
+    int GetLength() const override;
+    T* GetRef(int index) const;
+    T& At(int index);
+    const T& At(int index) const override;
+
+    Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override;
+    Sequence<T>* Concat(const Sequence<T>* other) const override;
+
+    Sequence<T>* Append(T item) override;
+    Sequence<T>* Prepend(T item) override;
+    Sequence<T>* InsertAt(T item, int index) override;
+    Sequence<T>* Remove(int index) override;
+
+    Sequence<T>* Instance() override;
+    Sequence<T>* Clone() const override;
+
+    // Moves items [index, length) into the returned sequence.
+    TreapSequence<T, Policy>* SplitAt(int index);
+    // Moves every item of other to the end of this sequence, leaving other empty.
+    void ConcatInPlace(TreapSequence<T, Policy>& other);
+
+    template <class F>
+    void ForEach(F visit) const;
+
+    // Nodes on the longest root-to-leaf path; O(log n) on average.
+    int GetHeight() const { return Height(root); }
+};
+
+template <class T, class Policy>
+void TreapSequence<T, Policy>::Update(Node* node) {
+    node->total = node->count + Total(node->left) + Total(node->right);
+}
+
+template <class T, class Policy>
+typename TreapSequence<T, Policy>::Node* TreapSequence<T, Policy>::Merge(Node* left, Node* right) {
+    if (!left) return right;
+    if (!right) return left;
+
+    if (left->priority >= right->priority) {
+        left->right = Merge(left->right, right);
+        Update(left);
+        return left;
+    }
+    right->left = Merge(left, right->left);
+    Update(right);
+    return right;
+}
+
+// Splits off the first `index` items. A chunk straddling the cut is divided;
+// its upper half becomes a new node with the given (fresh) priority and is
+// merged into the right part, so it settles where its priority belongs.
+template <class T, class Policy>
+std::pair<typename TreapSequence<T, Policy>::Node*, typename TreapSequence<T, Policy>::Node*>
+TreapSequence<T, Policy>::Split(Node* node, int index, unsigned priority) {
+    if (!node) return { nullptr, nullptr };
+
+    int leftTotal = Total(node->left);
+    if (index <= leftTotal) {
+        auto parts = Split(node->left, index, priority);
+        node->left = parts.second;
+        Update(node);
+        return { parts.first, node };
+    }
+    if (index >= leftTotal + node->count) {
+        auto parts = Split(node->right, index - leftTotal - node->count, priority);
+        node->right = parts.first;
+        Update(node);
+        return { node, parts.second };
+    }
+
+    int offset = index - leftTotal;
+    Node* upper = new Node(priority);
+    for (int i = offset; i < node->count; i++)
+        upper->items[upper->count++] = std::move(node->items[i]);
+    node->count = offset;
+    Node* right = node->right;
+    node->right = nullptr;
+    Update(upper);
+    Update(node);
+    return { node, Merge(upper, right) };
+}
+
+template <class T, class Policy>
+typename TreapSequence<T, Policy>::Node* TreapSequence<T, Policy>::Copy(const Node* node) {
+    if (!node) return nullptr;
+
+    Node* copy = new Node(node->priority);
+    for (int i = 0; i < node->count; i++) copy->items[i] = node->items[i];
+    copy->count = node->count;
+    copy->total = node->total;
+    copy->left = Copy(node->left);
+    copy->right = Copy(node->right);
+    return copy;
+}
+
+// Copies items [first, last] of the subtree, positions counted from its
+// start. Subtrees outside the range are skipped, so only the nodes holding
+// the range and the paths to them are visited.
+template <class T, class Policy>
+typename TreapSequence<T, Policy>::Node* TreapSequence<T, Policy>::CopyRange(const Node* node, int first, int last) {
+    if (!node || first > last) return nullptr;
+    if (first <= 0 && last >= node->total - 1) return Copy(node);
+
+    int leftTotal = Total(node->left);
+    int rightStart = leftTotal + node->count;
+    if (last < leftTotal) return CopyRange(node->left, first, last);
+    if (first >= rightStart) return CopyRange(node->right, first - rightStart, last - rightStart);
+
+    Node* copy = new Node(node->priority);
+    for (int i = std::max(first - leftTotal, 0); i <= std::min(last - leftTotal, node->count - 1); i++)
+        copy->items[copy->count++] = node->items[i];
+    copy->left = CopyRange(node->left, first, leftTotal - 1);
+    copy->right = CopyRange(node->right, 0, last - rightStart);
+    Update(copy);
+    return copy;
+}
+
+template <class T, class Policy>
+int TreapSequence<T, Policy>::Height(const Node* node) {
+    if (!node) return 0;
+    return 1 + std::max(Height(node->left), Height(node->right));
+}
+
+template <class T, class Policy>
+void TreapSequence<T, Policy>::Erase(Node* node) {
+    if (!node) return;
+    Erase(node->left);
+    Erase(node->right);
+    delete node;
+}
+
+template <class T, class Policy>
+template <class F>
+void TreapSequence<T, Policy>::Visit(const Node* node, F& visit) {
+    if (!node) return;
+    Visit(node->left, visit);
+    for (int i = 0; i < node->count; i++) visit(node->items[i]);
+    Visit(node->right, visit);
+}
+
+// Every sequence gets its own priority stream, so trees built the same way
+// do not share priorities when they are merged.
+template <class T, class Policy>
+unsigned TreapSequence<T, Policy>::NewSeed() {
+    static std::atomic<unsigned> counter(0);
+    return (2463534242u ^ (++counter * 0x9E3779B9u)) | 1u;
+}
+
+template <class T, class Policy>
+unsigned TreapSequence<T, Policy>::NextPriority() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+template <class T, class Policy>
+typename TreapSequence<T, Policy>::Node* TreapSequence<T, Policy>::Locate(int index, int& offset) const {
+    Node* node = root;
+    for (;;) {
+        int leftTotal = Total(node->left);
+        if (index < leftTotal) {
+            node = node->left;
+        }
+        else if (index < leftTotal + node->count) {
+            offset = index - leftTotal;
+            return node;
+        }
+        else {
+            index -= leftTotal + node->count;
+            node = node->right;
+        }
+    }
+}
+
+// Halves the full chunk that holds position index.
+template <class T, class Policy>
+void TreapSequence<T, Policy>::SplitChunk(int index) {
+    int offset = 0;
+    Locate(index, offset);
+    auto parts = Split(root, index - offset + ChunkCapacity / 2, NextPriority());
+    root = Merge(parts.first, parts.second);
+}
+
+template <class T, class Policy>
+TreapSequence<T, Policy>::TreapSequence() : root(nullptr), seed(NewSeed()) {}
+
+template <class T, class Policy>
+TreapSequence<T, Policy>::TreapSequence(T* items, int count) : TreapSequence() {
+    if (count < 0) throw Errors::NegativeCount();
+
+    for (int start = 0; start < count; start += ChunkCapacity) {
+        Node* node = new Node(NextPriority());
+        for (int i = start; i < count && node->count < ChunkCapacity; i++)
+            node->items[node->count++] = items[i];
+        Update(node);
+        root = Merge(root, node);
+    }
+}
+
+template <class T, class Policy>
+TreapSequence<T, Policy>::TreapSequence(const TreapSequence<T, Policy>& other)
+    : root(Copy(other.root)), seed(NewSeed()) {
+}
+
+template <class T, class Policy>
+TreapSequence<T, Policy>::~TreapSequence() {
+    Erase(root);
+}
+
+template <class T, class Policy>
+TreapSequence<T, Policy>& TreapSequence<T, Policy>::operator=(const TreapSequence<T, Policy>& other) {
+    if (this == &other) return *this;
+
+    Node* copy = Copy(other.root);
+    Erase(root);
+    root = copy;
+    return *this;
+}
+
+template <class T, class Policy>
+T TreapSequence<T, Policy>::GetFirst() const {
+    Policy::Require(root != nullptr, ErrorCode::EMPTY_LIST);
+    return At(0);
+}
+
+template <class T, class Policy>
+T TreapSequence<T, Policy>::GetLast() const {
+    Policy::Require(root != nullptr, ErrorCode::EMPTY_LIST);
+    return At(GetLength() - 1);
+}
+
+template <class T, class Policy>
+T TreapSequence<T, Policy>::Get(int index) const {
+    return At(index);
+}
+
+template <class T, class Policy>
+Result<T> TreapSequence<T, Policy>::TryGetFirst() const {
+    if (!root) return ErrorCode::EMPTY_LIST;
+    return At(0);
+}
+
+template <class T, class Policy>
+Result<T> TreapSequence<T, Policy>::TryGetLast() const {
+    if (!root) return ErrorCode::EMPTY_LIST;
+    return At(GetLength() - 1);
+}
+
+template <class T, class Policy>
+Result<T> TreapSequence<T, Policy>::TryGet(int index) const {
+    if (index < 0 || index >= GetLength()) return ErrorCode::INDEX_OUT_OF_RANGE;
+    return At(index);
+}
+
+template <class T, class Policy>
+int TreapSequence<T, Policy>::GetLength() const {
+    return Total(root);
+}
+
+template <class T, class Policy>
+T* TreapSequence<T, Policy>::GetRef(int index) const {
+    Policy::Require(index >= 0 && index < GetLength(), ErrorCode::INDEX_OUT_OF_RANGE);
+    int offset = 0;
+    Node* node = Locate(index, offset);
+    return &node->items[offset];
+}
+
+template <class T, class Policy>
+T& TreapSequence<T, Policy>::At(int index) {
+    return *GetRef(index);
+}
+
+template <class T, class Policy>
+const T& TreapSequence<T, Policy>::At(int index) const {
+    return *GetRef(index);
+}
+
+template <class T, class Policy>
+Sequence<T>* TreapSequence<T, Policy>::GetSubsequence(int startIndex, int endIndex) const {
+    Policy::Require(startIndex >= 0 && endIndex < GetLength() && startIndex <= endIndex, ErrorCode::INVALID_INDICES);
+
+    auto* result = new TreapSequence<T, Policy>();
+    result->root = CopyRange(root, startIndex, endIndex);
+    return result;
+}
+
+template <class T, class Policy>
+Sequence<T>* TreapSequence<T, Policy>::Concat(const Sequence<T>* other) const {
+    auto otherTreap = dynamic_cast<const TreapSequence<T, Policy>*>(other);
+    if (!otherTreap) throw Errors::IncompatibleTypes();
+
+    auto* result = new TreapSequence<T, Policy>();
+    result->root = Merge(Copy(root), Copy(otherTreap->root));
+    return result;
+}
+
+template <class T, class Policy>
+Sequence<T>* TreapSequence<T, Policy>::Append(T item) {
+    return InsertAt(item, GetLength());
+}
+
+template <class T, class Policy>
+Sequence<T>* TreapSequence<T, Policy>::Prepend(T item) {
+    return InsertAt(item, 0);
+}
+
+template <class T, class Policy>
+Sequence<T>* TreapSequence<T, Policy>::InsertAt(T item, int index) {
+    Policy::Require(index >= 0 && index <= GetLength(), ErrorCode::INDEX_OUT_OF_RANGE);
+
+    if (!root) {
+        root = new Node(NextPriority());
+        root->items[root->count++] = item;
+        Update(root);
+        return this;
+    }
+
+    int offset = 0;
+    int target = index == GetLength() ? index - 1 : index;
+    if (Locate(target, offset)->count == ChunkCapacity) SplitChunk(target);
+
+    // Walk down again, counting the new item into every subtree on the path.
+    Node* node = root;
+    for (;;) {
+        node->total++;
+        int leftTotal = Total(node->left);
+        if (index < leftTotal) {
+            node = node->left;
+        }
+        else if (index <= leftTotal + node->count && (index < leftTotal + node->count || !node->right)) {
+            offset = index - leftTotal;
+            break;
+        }
+        else {
+            index -= leftTotal + node->count;
+            node = node->right;
+        }
+    }
+
+    for (int i = node->count; i > offset; i--)
+        node->items[i] = std::move(node->items[i - 1]);
+    node->items[offset] = item;
+    node->count++;
+    return this;
+}
+
+template <class T, class Policy>
+Sequence<T>* TreapSequence<T, Policy>::Remove(int index) {
+    Policy::Require(root != nullptr, ErrorCode::EMPTY_LIST);
+    Policy::Require(index >= 0 && index < GetLength(), ErrorCode::INDEX_OUT_OF_RANGE);
+
+    Node** link = &root;
+    for (;;) {
+        Node* node = *link;
+        node->total--;
+        int leftTotal = Total(node->left);
+        if (index < leftTotal) {
+            link = &node->left;
+        }
+        else if (index < leftTotal + node->count) {
+            int offset = index - leftTotal;
+            for (int i = offset; i < node->count - 1; i++)
+                node->items[i] = std::move(node->items[i + 1]);
+            node->count--;
+            if (node->count == 0) {
+                *link = Merge(node->left, node->right);
+                delete node;
+            }
+            return this;
+        }
+        else {
+            index -= leftTotal + node->count;
+            link = &node->right;
+        }
+    }
+}
+
+template <class T, class Policy>
+Sequence<T>* TreapSequence<T, Policy>::Instance() {
+    return this;
+}
+
+template <class T, class Policy>
+Sequence<T>* TreapSequence<T, Policy>::Clone() const {
+    return new TreapSequence<T, Policy>(*this);
+}
+
+template <class T, class Policy>
+TreapSequence<T, Policy>* TreapSequence<T, Policy>::SplitAt(int index) {
+    Policy::Require(index >= 0 && index <= GetLength(), ErrorCode::INDEX_OUT_OF_RANGE);
+
+    auto parts = Split(root, index, NextPriority());
+    root = parts.first;
+    auto* tail = new TreapSequence<T, Policy>();
+    tail->root = parts.second;
+    return tail;
+}
+
+template <class T, class Policy>
+void TreapSequence<T, Policy>::ConcatInPlace(TreapSequence<T, Policy>& other) {
+    if (this == &other) throw Errors::InvalidArgument("cannot concat a sequence with itself");
+
+    root = Merge(root, other.root);
+    other.root = nullptr;
+}
+
+template <class T, class Policy>
+template <class F>
+void TreapSequence<T, Policy>::ForEach(F visit) const {
+    Visit(root, visit);
+}
\ No newline at end of file
@@ -0,0 +1,398 @@
+#pragma once
+
+#include <type_traits>
+
+#include "Sequence.hpp"
+#include "DynamicArray.hpp"
+#include "LinkedList.hpp"
+#include "ArraySequence.hpp"
+#include "ListSequence.hpp"
+#include "BoundsPolicy.hpp"
+#include "error.hpp"
+
+// Lazy pipelines over sequences, arrays and lists. View::From(...) wraps a
+// container without copying it; Where/Map/Take/Skip/Slice/Concat only build
+// a small description of the work, and a terminal (ToArraySequence,
+// ToListSequence, Reduce, Count, ForEach) pushes every item through all the
+// stages in one pass. Views point at their source containers, so a view must
+// not outlive them.
+//
+// Each stage implements Run(sink): it calls sink(item) for each item and
+// stops once sink returns false. Run returns false only if the sink asked to
+// stop, so Concat keeps going after a Take in its first half.
+
+namespace View {
+
+    template <class Upstream, class F> class WhereView;
+    template <class Upstream, class F> class MapView;
+    template <class Upstream> class TakeView;
+    template <class Upstream> class SkipView;
+    template <class First, class Second> class ConcatView;
+
+    template <class Derived, class T>
+    class Pipeline {
+    protected:
+        const Derived& Self() const { return static_cast<const Derived&>(*this); }
+
+    public:
+        using value_type = T;
+
+        template <class F>
+        WhereView<Derived, F> Where(F predicate) const;
+        template <class F>
+        MapView<Derived, F> Map(F f) const;
+        TakeView<Derived> Take(int count) const;
+        SkipView<Derived> Skip(int count) const;
+        TakeView<SkipView<Derived>> Slice(int startIndex, int endIndex) const;
+        template <class Other>
+        ConcatView<Derived, Other> Concat(const Other& other) const;
+
+        template <class F>
+        void ForEach(F visit) const;
+        template <class R, class F>
+        R Reduce(R initial, F op) const;
+        int Count() const;
+        MutableArraySequence<T> ToArraySequence() const;
+        MutableListSequence<T> ToListSequence() const;
+    };
+
+
+    template <class T>
+    class ArraySource : public Pipeline<ArraySource<T>, T> {
+    private:
+        const T* data;
+        int size;
+
+    public:
+        ArraySource(const T* data, int size) : data(data), size(size) {}
+
+        template <class Sink>
+        bool Run(Sink& sink) const;
+
+        // Narrowing a contiguous range needs no extra stage.
+        ArraySource<T> Take(int count) const;
+        ArraySource<T> Skip(int count) const;
+        ArraySource<T> Slice(int startIndex, int endIndex) const;
+        int Count() const { return size; }
+    };
+
+    template <class T>
+    template <class Sink>
+    bool ArraySource<T>::Run(Sink& sink) const {
+        for (int i = 0; i < size; i++)
+            if (!sink(data[i])) return false;
+        return true;
+    }
+
+    template <class T>
+    ArraySource<T> ArraySource<T>::Take(int count) const {
+        if (count < 0) throw Errors::NegativeCount();
+        return ArraySource<T>(data, count < size ? count : size);
+    }
+
+    template <class T>
+    ArraySource<T> ArraySource<T>::Skip(int count) const {
+        if (count < 0) throw Errors::NegativeCount();
+        if (count > size) count = size;
+        return ArraySource<T>(data + count, size - count);
+    }
+
+    template <class T>
+    ArraySource<T> ArraySource<T>::Slice(int startIndex, int endIndex) const {
+        if (startIndex < 0 || endIndex < startIndex) throw Errors::InvalidIndices();
+        return Skip(startIndex).Take(endIndex - startIndex + 1);
+    }
+
+
+    template <class T, class Policy>
+    class ListSource : public Pipeline<ListSource<T, Policy>, T> {
+    private:
+        const LinkedList<T, Policy>* list;
+
+    public:
+        explicit ListSource(const LinkedList<T, Policy>& list) : list(&list) {}
+
+        template <class Sink>
+        bool Run(Sink& sink) const {
+            return list->ForEachWhile([&sink](const T& item) { return sink(item); });
+        }
+    };
+
+
+    // Any Sequence<T>: array and list sequences are walked directly, anything
+    // else falls back to At(i).
+    template <class T>
+    class SequenceSource : public Pipeline<SequenceSource<T>, T> {
+    private:
+        const Sequence<T>* seq;
+        const MutableListSequence<T>* list;
+        const T* data;
+
+        template <class Policy>
+        static const T* ArrayData(const Sequence<T>& seq);
+
+    public:
+        explicit SequenceSource(const Sequence<T>& seq);
+
+        template <class Sink>
+        bool Run(Sink& sink) const;
+    };
+
+    template <class T>
+    template <class Policy>
+    const T* SequenceSource<T>::ArrayData(const Sequence<T>& seq) {
+        auto array = dynamic_cast<const MutableArraySequence<T, Policy>*>(&seq);
+        return array ? array->Data() : nullptr;
+    }
+
+    template <class T>
+    SequenceSource<T>::SequenceSource(const Sequence<T>& seq) : seq(&seq), list(nullptr), data(nullptr) {
+        data = ArrayData<Checked>(seq);
+        if (!data) data = ArrayData<DebugAssert>(seq);
+        if (!data) data = ArrayData<Unchecked>(seq);
+        if (!data) list = dynamic_cast<const MutableListSequence<T>*>(&seq);
+    }
+
+    template <class T>
+    template <class Sink>
+    bool SequenceSource<T>::Run(Sink& sink) const {
+        if (list) return list->ForEachWhile([&sink](const T& item) { return sink(item); });
+
+        int size = seq->GetLength();
+        if (data) {
+            for (int i = 0; i < size; i++)
+                if (!sink(data[i])) return false;
+            return true;
+        }
+        for (int i = 0; i < size; i++)
+            if (!sink(seq->At(i))) return false;
+        return true;
+    }
+
+
+    template <class Upstream, class F>
+    class WhereView : public Pipeline<WhereView<Upstream, F>, typename Upstream::value_type> {
+    private:
+        using T = typename Upstream::value_type;
+
+        Upstream upstream;
+        F predicate;
+
+    public:
+        WhereView(const Upstream& upstream, F predicate) : upstream(upstream), predicate(predicate) {}
+
+        template <class Sink>
+        bool Run(Sink& sink) const {
+            auto filter = [&](const T& item) { return !predicate(item) || sink(item); };
+            return upstream.Run(filter);
+        }
+    };
+
+
+    template <class Upstream, class F>
+    class MapView : public Pipeline<MapView<Upstream, F>,
+        std::decay_t<std::invoke_result_t<const F&, const typename Upstream::value_type&>>> {
+    private:
+        using T = typename Upstream::value_type;
+
+        Upstream upstream;
+        F f;
+
+    public:
+        MapView(const Upstream& upstream, F f) : upstream(upstream), f(f) {}
+
+        template <class Sink>
+        bool Run(Sink& sink) const {
+            auto map = [&](const T& item) { return sink(f(item)); };
+            return upstream.Run(map);
+        }
+    };
+
+
+    template <class Upstream>
+    class TakeView : public Pipeline<TakeView<Upstream>, typename Upstream::value_type> {
+    private:
+        using T = typename Upstream::value_type;
+
+        Upstream upstream;
+        int count;
+
+    public:
+        TakeView(const Upstream& upstream, int count) : upstream(upstream), count(count) {
+            if (count < 0) throw Errors::NegativeCount();
+        }
+
+        template <class Sink>
+        bool Run(Sink& sink) const {
+            if (count == 0) return true;
+            int left = count;
+            bool wantsMore = true;
+            auto take = [&](const T& item) {
+                wantsMore = sink(item);
+                return wantsMore && --left > 0;
+            };
+            upstream.Run(take);
+            return wantsMore;
+        }
+    };
+
+
+    template <class Upstream>
+    class SkipView : public Pipeline<SkipView<Upstream>, typename Upstream::value_type> {
+    private:
+        using T = typename Upstream::value_type;
+
+        Upstream upstream;
+        int count;
+
+    public:
+        SkipView(const Upstream& upstream, int count) : upstream(upstream), count(count) {
+            if (count < 0) throw Errors::NegativeCount();
+        }
+
+        template <class Sink>
+        bool Run(Sink& sink) const {
+            int skipped = 0;
+            auto skip = [&](const T& item) {
+                if (skipped < count) {
+                    skipped++;
+                    return true;
+                }
+                return sink(item);
+            };
+            return upstream.Run(skip);
+        }
+    };
+
+
+    template <class First, class Second>
+    class ConcatView : public Pipeline<ConcatView<First, Second>, typename First::value_type> {
+    private:
+        static_assert(std::is_same_v<typename First::value_type, typename Second::value_type>,
+            "concatenated views must have the same value type");
+
+        First first;
+        Second second;
+
+    public:
+        ConcatView(const First& first, const Second& second) : first(first), second(second) {}
+
+        template <class Sink>
+        bool Run(Sink& sink) const {
+            return first.Run(sink) && second.Run(sink);
+        }
+    };
+
+
+    template <class Derived, class T>
+    template <class F>
+    WhereView<Derived, F> Pipeline<Derived, T>::Where(F predicate) const {
+        return WhereView<Derived, F>(Self(), predicate);
+    }
+
+    template <class Derived, class T>
+    template <class F>
+    MapView<Derived, F> Pipeline<Derived, T>::Map(F f) const {
+        return MapView<Derived, F>(Self(), f);
+    }
+
+    template <class Derived, class T>
+    TakeView<Derived> Pipeline<Derived, T>::Take(int count) const {
+        return TakeView<Derived>(Self(), count);
+    }
+
+    template <class Derived, class T>
+    SkipView<Derived> Pipeline<Derived, T>::Skip(int count) const {
+        return SkipView<Derived>(Self(), count);
+    }
+
+    // Items startIndex..endIndex inclusive, like GetSubsequence; a range past
+    // the end is cut short rather than rejected.
+    template <class Derived, class T>
+    TakeView<SkipView<Derived>> Pipeline<Derived, T>::Slice(int startIndex, int endIndex) const {
+        if (startIndex < 0 || endIndex < startIndex) throw Errors::InvalidIndices();
+        return Skip(startIndex).Take(endIndex - startIndex + 1);
+    }
+
+    template <class Derived, class T>
+    template <class Other>
+    ConcatView<Derived, Other> Pipeline<Derived, T>::Concat(const Other& other) const {
+        return ConcatView<Derived, Other>(Self(), other);
+    }
+
+    template <class Derived, class T>
+    template <class F>
+    void Pipeline<Derived, T>::ForEach(F visit) const {
+        auto sink = [&](const T& item) {
+            visit(item);
+            return true;
+        };
+        Self().Run(sink);
+    }
+
+    template <class Derived, class T>
+    template <class R, class F>
+    R Pipeline<Derived, T>::Reduce(R initial, F op) const {
+        R result = initial;
+        auto sink = [&](const T& item) {
+            result = op(result, item);
+            return true;
+        };
+        Self().Run(sink);
+        return result;
+    }
+
+    template <class Derived, class T>
+    int Pipeline<Derived, T>::Count() const {
+        int count = 0;
+        auto sink = [&](const T&) {
+            count++;
+            return true;
+        };
+        Self().Run(sink);
+        return count;
+    }
+
+    template <class Derived, class T>
+    MutableArraySequence<T> Pipeline<Derived, T>::ToArraySequence() const {
+        MutableArraySequence<T> result;
+        auto sink = [&](const T& item) {
+            result.Append(item);
+            return true;
+        };
+        Self().Run(sink);
+        return result;
+    }
+
+    template <class Derived, class T>
+    MutableListSequence<T> Pipeline<Derived, T>::ToListSequence() const {
+        MutableListSequence<T> result;
+        auto sink = [&](const T& item) {
+            result.Append(item);
+            return true;
+        };
+        Self().Run(sink);
+        return result;
+    }
+
+
+    template <class T, class Policy, int N>
+    ArraySource<T> From(const DynamicArray<T, Policy, N>& array) {
+        return ArraySource<T>(array.Data(), array.GetSize());
+    }
+
+    template <class T, class Policy, class Storage>
+    ArraySource<T> From(const MutableArraySequence<T, Policy, Storage>& seq) {
+        return ArraySource<T>(seq.Data(), seq.GetLength());
+    }
+
+    template <class T, class Policy>
+    ListSource<T, Policy> From(const LinkedList<T, Policy>& list) {
+        return ListSource<T, Policy>(list);
+    }
+
+    template <class T>
+    SequenceSource<T> From(const Sequence<T>& seq) {
+        return SequenceSource<T>(seq);
+    }
+}
\ No newline at end of file
@@ -1,126 +1,225 @@
-#pragma once
-
-#include <string>
-#include <vector>
-#include <exception>
-#include <stdexcept>
-
-struct Error {
-    int code;
-    std::string message;
-};
-
-enum class ErrorCode {
-    OK = 0,
-    IMMUTABLE,
-    INDEX_OUT_OF_RANGE,
-    INVALID_ARGUMENT,
-    EMPTY_ARRAY,
-    EMPTY_LIST,
-    INCOMPATIBLE_TYPES,
-    EMPTY_VALUE,
-    NEGATIVE_SIZE,
-    INVALID_INDICES,
-    NEGATIVE_COUNT,
-    NULL_LIST,
-    CONCAT_TYPE_MISMATCH,
-    EMPTY_STACK
-};
-
-std::vector<Error> ErrorsList = {
-    {0, "Success"},
-    {1, "Immutable object"},
-    {2, "Index out of range"},
-    {3, "Invalid argument"},
-    {4, "Empty array"},
-    {5, "Empty list"},
-    {6, "Incompatible types"},
-    {7, "Empty value"},
-    {8, "Negative size not allowed"},
-    {9, "Invalid indices"},
-    {10, "Negative count"},
-    {11, "Null list"},
-    {12, "Cannot concat sequences of different types"},
-    {13, "Empty stack"}
-};
-
-namespace Errors {
-
-    class BaseError : public std::exception {
-    protected:
-        ErrorCode code;
-        std::string msg;
-    public:
-        BaseError(ErrorCode code_, const std::string& custom_message = "") : code(code_) {
-            if (custom_message.empty()) {
-                msg = ErrorsList[static_cast<int>(code_)].message;
-            }
-            else {
-                msg = ErrorsList[static_cast<int>(code_)].message + ": " + custom_message;
-            }
-        }
-
-        const char* what() const noexcept override {
-            return msg.c_str();
-        }
-
-        ErrorCode Code() const noexcept {
-            return code;
-        }
-    };
-
-    inline std::logic_error Immutable() {
-        return std::logic_error(ErrorsList[static_cast<int>(ErrorCode::IMMUTABLE)].message);
-    }
-
-    inline std::out_of_range IndexOutOfRange() {
-        return std::out_of_range(ErrorsList[static_cast<int>(ErrorCode::INDEX_OUT_OF_RANGE)].message);
-    }
-
-    inline std::invalid_argument InvalidArgument(const std::string& message = "") {
-        if (message.empty())
-            return std::invalid_argument(ErrorsList[static_cast<int>(ErrorCode::INVALID_ARGUMENT)].message);
-        else
-            return std::invalid_argument(ErrorsList[static_cast<int>(ErrorCode::INVALID_ARGUMENT)].message + ": " + message);
-    }
-
-    inline std::out_of_range EmptyArray() {
-        return std::out_of_range(ErrorsList[static_cast<int>(ErrorCode::EMPTY_ARRAY)].message);
-    }
-
-    inline std::out_of_range EmptyList() {
-        return std::out_of_range(ErrorsList[static_cast<int>(ErrorCode::EMPTY_LIST)].message);
-    }
-
-    inline std::invalid_argument IncompatibleTypes() {
-        return std::invalid_argument(ErrorsList[static_cast<int>(ErrorCode::INCOMPATIBLE_TYPES)].message);
-    }
-
-    inline std::runtime_error EmptyValue() {
-        return std::runtime_error(ErrorsList[static_cast<int>(ErrorCode::EMPTY_VALUE)].message);
-    }
-
-    inline std::invalid_argument NegativeSize() {
-        return std::invalid_argument(ErrorsList[static_cast<int>(ErrorCode::NEGATIVE_SIZE)].message);
-    }
-
-    inline std::out_of_range InvalidIndices() {
-        return std::out_of_range(ErrorsList[static_cast<int>(ErrorCode::INVALID_INDICES)].message);
-    }
-
-    inline std::invalid_argument NegativeCount() {
-        return std::invalid_argument(ErrorsList[static_cast<int>(ErrorCode::NEGATIVE_COUNT)].message);
-    }
-
-    inline std::invalid_argument NullList() {
-        return std::invalid_argument(ErrorsList[static_cast<int>(ErrorCode::NULL_LIST)].message);
-    }
-
-    inline std::logic_error ConcatTypeMismatchError() {
-        return std::logic_error(ErrorsList[static_cast<int>(ErrorCode::CONCAT_TYPE_MISMATCH)].message);
-    }
-
-    inline std::runtime_error EmptyStackError() {
-        return std::runtime_error(ErrorsList[static_cast<int>(ErrorCode::EMPTY_STACK)].message);
-    }
-}
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string_view>
+
+struct Error {
+    int code;
+    std::string_view message;
+};
+
+enum class ErrorCode {
+    OK = 0,
+    IMMUTABLE,
+    INDEX_OUT_OF_RANGE,
+    INVALID_ARGUMENT,
+    EMPTY_ARRAY,
+    EMPTY_LIST,
+    INCOMPATIBLE_TYPES,
+    EMPTY_VALUE,
+    NEGATIVE_SIZE,
+    INVALID_INDICES,
+    NEGATIVE_COUNT,
+    NULL_LIST,
+    CONCAT_TYPE_MISMATCH,
+    EMPTY_STACK,
+    CONTAINER_FULL,
+    IO_ERROR
+};
+
+inline constexpr std::array<Error, 16> ErrorsList = { {
+    {0, "Success"},
+    {1, "Immutable object"},
+    {2, "Index out of range"},
+    {3, "Invalid argument"},
+    {4, "Empty array"},
+    {5, "Empty list"},
+    {6, "Incompatible types"},
+    {7, "Empty value"},
+    {8, "Negative size not allowed"},
+    {9, "Invalid indices"},
+    {10, "Negative count"},
+    {11, "Null list"},
+    {12, "Cannot concat sequences of different types"},
+    {13, "Empty stack"},
+    {14, "Container is full"},
+    {15, "Input/output error"}
+} };
+
+constexpr std::string_view ErrorMessage(ErrorCode code) {
+    return ErrorsList[static_cast<int>(code)].message;
+}
+
+namespace Errors {
+
+    // Messages from ErrorsList are string literals, so what() can point at them
+    // directly; only a custom suffix is copied into the fixed in-object buffer.
+    // A message that does not fit is cut and ends in "...".
+    //
+    // BaseError carries the code and message and is not itself a
+    // std::exception: StdError below pairs it with the std category, so every
+    // error is caught both as Errors::* and as std::out_of_range,
+    // std::invalid_argument, std::logic_error or std::runtime_error.
+    class BaseError {
+    protected:
+        static constexpr std::size_t Capacity = 128;
+
+        ErrorCode code;
+        const char* text;
+        char buffer[Capacity];
+
+    public:
+        explicit BaseError(ErrorCode code_, std::string_view custom_message = {}) noexcept
+            : code(code_), text(ErrorMessage(code_).data()) {
+            buffer[0] = '\0';
+            if (custom_message.empty()) return;
+
+            std::size_t length = 0;
+            bool cut = false;
+            auto append = [&](std::string_view part) {
+                for (std::size_t i = 0; i < part.size(); ++i) {
+                    if (length + 1 == Capacity) {
+                        cut = true;
+                        return;
+                    }
+                    buffer[length++] = part[i];
+                }
+            };
+            append(ErrorMessage(code_));
+            append(": ");
+            append(custom_message);
+            if (cut)
+                for (std::size_t i = length - 3; i < length; ++i) buffer[i] = '.';
+            buffer[length] = '\0';
+            text = buffer;
+        }
+
+        BaseError(const BaseError& other) noexcept : code(other.code), text(other.text) {
+            for (std::size_t i = 0; i < Capacity; ++i) buffer[i] = other.buffer[i];
+            if (other.text == other.buffer) text = buffer;
+        }
+
+        BaseError& operator=(const BaseError& other) noexcept {
+            code = other.code;
+            for (std::size_t i = 0; i < Capacity; ++i) buffer[i] = other.buffer[i];
+            text = other.text == other.buffer ? buffer : other.text;
+            return *this;
+        }
+
+        virtual ~BaseError() = default;
+
+        virtual const char* what() const noexcept {
+            return text;
+        }
+
+        ErrorCode Code() const noexcept {
+            return code;
+        }
+    };
+
+    class LogicError : public BaseError {
+    public:
+        using BaseError::BaseError;
+    };
+
+    // The std base gets an empty message, which the standard library keeps
+    // without allocating; what() answers from the BaseError buffer.
+    template <class StdBase, class Category>
+    class StdError : public StdBase, public Category {
+    public:
+        explicit StdError(ErrorCode code_, std::string_view custom_message = {})
+            : StdBase(""), Category(code_, custom_message) {}
+
+        const char* what() const noexcept override {
+            return Category::what();
+        }
+    };
+
+    using OutOfRangeError = StdError<std::out_of_range, LogicError>;
+    using InvalidArgumentError = StdError<std::invalid_argument, LogicError>;
+    using RuntimeError = StdError<std::runtime_error, BaseError>;
+
+    inline StdError<std::logic_error, LogicError> Immutable() {
+        return StdError<std::logic_error, LogicError>(ErrorCode::IMMUTABLE);
+    }
+
+    inline OutOfRangeError IndexOutOfRange() {
+        return OutOfRangeError(ErrorCode::INDEX_OUT_OF_RANGE);
+    }
+
+    inline InvalidArgumentError InvalidArgument(std::string_view message = {}) {
+        return InvalidArgumentError(ErrorCode::INVALID_ARGUMENT, message);
+    }
+
+    inline OutOfRangeError EmptyArray() {
+        return OutOfRangeError(ErrorCode::EMPTY_ARRAY);
+    }
+
+    inline OutOfRangeError EmptyList() {
+        return OutOfRangeError(ErrorCode::EMPTY_LIST);
+    }
+
+    inline InvalidArgumentError IncompatibleTypes() {
+        return InvalidArgumentError(ErrorCode::INCOMPATIBLE_TYPES);
+    }
+
+    inline RuntimeError EmptyValue() {
+        return RuntimeError(ErrorCode::EMPTY_VALUE);
+    }
+
+    inline InvalidArgumentError NegativeSize() {
+        return InvalidArgumentError(ErrorCode::NEGATIVE_SIZE);
+    }
+
+    inline OutOfRangeError InvalidIndices() {
+        return OutOfRangeError(ErrorCode::INVALID_INDICES);
+    }
+
+    inline InvalidArgumentError NegativeCount() {
+        return InvalidArgumentError(ErrorCode::NEGATIVE_COUNT);
+    }
+
+    inline InvalidArgumentError NullList() {
+        return InvalidArgumentError(ErrorCode::NULL_LIST);
+    }
+
+    inline StdError<std::logic_error, LogicError> ConcatTypeMismatchError() {
+        return StdError<std::logic_error, LogicError>(ErrorCode::CONCAT_TYPE_MISMATCH);
+    }
+
+    inline RuntimeError EmptyStackError() {
+        return RuntimeError(ErrorCode::EMPTY_STACK);
+    }
+
+    inline RuntimeError ContainerFull() {
+        return RuntimeError(ErrorCode::CONTAINER_FULL);
+    }
+
+    inline RuntimeError IoError(std::string_view message = {}) {
+        return RuntimeError(ErrorCode::IO_ERROR, message);
+    }
+
+    [[noreturn]] inline void Throw(ErrorCode code) {
+        switch (code) {
+        case ErrorCode::INDEX_OUT_OF_RANGE:
+        case ErrorCode::EMPTY_ARRAY:
+        case ErrorCode::EMPTY_LIST:
+        case ErrorCode::INVALID_INDICES:
+            throw OutOfRangeError(code);
+        case ErrorCode::INVALID_ARGUMENT:
+        case ErrorCode::INCOMPATIBLE_TYPES:
+        case ErrorCode::NEGATIVE_SIZE:
+        case ErrorCode::NEGATIVE_COUNT:
+        case ErrorCode::NULL_LIST:
+            throw InvalidArgumentError(code);
+        case ErrorCode::IMMUTABLE:
+        case ErrorCode::CONCAT_TYPE_MISMATCH:
+            throw StdError<std::logic_error, LogicError>(code);
+        default:
+            throw RuntimeError(code);
+        }
+    }
+}
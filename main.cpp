@@ -1,33 +1,54 @@
-#include "Interface.hpp"
-#include "test.hpp"
-
-//#define DA_TEST
-//#define LL_TEST
-//#define AS_TEST
-//#define LS_TEST
-//#define ALL_TEST
-
-int main() {
-
-#ifdef DA_TEST
-    DynamicArrayTest();
-#endif
-
-#ifdef LL_TEST
-    LinkedListTest();
-#endif
-
-#ifdef AS_TEST
-    ArraySequenceTest();
-#endif
-
-#ifdef LS_TEST
-    ListSequenceTest();
-#endif
-
-#ifdef ALL_TEST
-    AllTests();
-#endif
-    TimeTest();
-    //Run();
+#include "Interface.hpp"
+#include "test.hpp"
+
+//#define DA_TEST
+//#define LL_TEST
+//#define AS_TEST
+//#define LS_TEST
+//#define ALL_TEST
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) return RunCommandLine(argc, argv);
+
+#ifdef DA_TEST
+    DynamicArrayTest();
+#endif
+
+#ifdef LL_TEST
+    LinkedListTest();
+#endif
+
+#ifdef AS_TEST
+    ArraySequenceTest();
+#endif
+
+#ifdef LS_TEST
+    ListSequenceTest();
+#endif
+
+#ifdef ALL_TEST
+    AllTests();
+#endif
+    TimeTest();
+    //StaticDispatchTimeTest();
+    //StudentTableTimeTest();
+    //KernelsTimeTest();
+    //ParallelTimeTest();
+    //ViewTimeTest();
+    //SortTimeTest();
+    //HashIndexTimeTest();
+    //TreapSequenceTimeTest();
+    //GapBufferSequenceTimeTest();
+    //StaticContainersTimeTest();
+    //SmallBufferTimeTest();
+    //MemoryResourceTimeTest();
+    //MmapDynamicArrayTimeTest();
+    //SerializeTimeTest();
+    //CsvLoaderTimeTest();
+    //ScriptTimeTest();
+    //TraceTimeTest();
+    //DumpTimeTest();
+    //ConcurrentAppendTimeTest();
+    //ConcurrentArraySequenceTimeTest();
+    //Run();
 }
\ No newline at end of file
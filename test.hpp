@@ -1,462 +1,2947 @@
-#pragma once
-
-#include <assert.h>
-#include <iostream>
-#include <chrono>
-
-#include "DynamicArray.hpp"
-#include "LinkedList.hpp"
-#include "ArraySequence.hpp"
-#include "ListSequence.hpp"
-
-#include "Stack.hpp"
-#include "Queue.hpp"
-#include "Deque.hpp"
-
-#include "User.hpp"
-
-
-void DynamicArrayTest() {
-    std::cout << "DynamicArray tests: ";
-    DynamicArray<int> arr(3);
-    arr.Set(0, 10);
-    arr.Set(1, 20);
-    arr.Set(2, 30);
-
-    DynamicArray<int> expected1(3);
-    expected1.Set(0, 10);
-    expected1.Set(1, 20);
-    expected1.Set(2, 30);
-    assert(arr == expected1);
-
-    arr.Resize(5);
-    assert(arr.GetSize() == 5);
-
-    arr.Resize(2);
-    DynamicArray<int> expected2(2);
-    expected2.Set(0, 10);
-    expected2.Set(1, 20);
-    assert(arr == expected2);
-
-    arr.Remove(1);
-    assert(arr.GetSize() == 1);
-
-    std::cout << "all tests were completed successfully.\n";
-}
-
-void LinkedListTest() {
-    std::cout << "LinkedList tests: ";
-    LinkedList<int> list;
-    list.Append(1);
-    list.Append(2);
-    list.Prepend(0);
-
-    assert(list.GetLength() == 3);
-    assert(list.GetFirst() == 0);
-    assert(list.GetLast() == 2);
-    assert(list.Get(1) == 1);
-
-
-    list.InsertAt(5, 1);
-    assert(list.Get(1) == 5);
-    assert(list.Get(2) == 1);
-
-    LinkedList<int>* sub = list.GetSubList(1, 2);
-    assert(sub->GetLength() == 2);
-    assert(sub->Get(0) == 5);
-    assert(sub->Get(1) == 1);
-
-    std::cout << "all tests were completed successfully.\n";
-}
-
-void ArraySequenceTest() {
-    std::cout << "ArraySequence tests: ";
-    MutableArraySequence<int> seq;
-    seq.Append(1);
-    seq.Append(2);
-    seq.Prepend(0);
-
-    assert(seq.GetLength() == 3);
-    assert(seq.Get(0) == 0);
-    assert(seq.Get(2) == 2);
-
-    seq.InsertAt(5, 1);
-    assert(seq.Get(1) == 5);
-    assert(seq.Get(2) == 1);
-
-    auto sub = seq.GetSubsequence(1, 3);
-    assert(sub->GetLength() == 3);
-    assert(sub->Get(0) == 5);
-
-    std::cout << "all tests were completed successfully.\n";
-}
-
-void ListSequenceTest() {
-    std::cout << "ListSequence tests: ";
-
-    MutableListSequence<int> seq;
-    seq.Append(1);
-    seq.Append(2);
-    seq.Prepend(0);
-
-    assert(seq.GetLength() == 3);
-    assert(seq.Get(0) == 0);
-    assert(seq.Get(2) == 2);
-
-    seq.InsertAt(5, 1);
-    assert(seq.Get(1) == 5);
-    assert(seq.Get(2) == 1);
-
-    auto sub = seq.GetSubsequence(1, 3);
-    assert(sub->GetLength() == 3);
-    assert(sub->Get(0) == 5);
-
-    std::cout << "all tests were completed successfully.\n";
-}
-
-void ArrayQueueTest() {
-    std::cout << "ArrayQueue tests: ";
-    ArrayQueue<int> q;
-    q.Enqueue(1);
-    q.Enqueue(2);
-    q.Enqueue(3);
-    assert(q.GetLength() == 3);
-    assert(q.Peek() == 1);
-    assert(q.Dequeue() == 1);
-    assert(q.Get(0) == 2);
-    std::cout << "all tests were completed successfully.\n";
-}
-
-void ListQueueTest() {
-    std::cout << "ListQueue tests: ";
-    ListQueue<int> q;
-    q.Enqueue(10);
-    q.Enqueue(20);
-    q.Enqueue(30);
-    assert(q.GetLength() == 3);
-    assert(q.Peek() == 10);
-    assert(q.Dequeue() == 10);
-    assert(q.Get(0) == 20);
-    std::cout << "all tests were completed successfully.\n";
-}
-
-void ArrayStackTest() {
-    std::cout << "ArrayStack tests: ";
-    ArrayStack<std::string> st;
-    st.Push("hello");
-    st.Push("world");
-    assert(st.Top() == "world");
-    assert(st.Pop() == "world");
-    assert(st.Top() == "hello");
-    assert(st.GetLength() == 1);
-    std::cout << "all tests were completed successfully.\n";
-}
-
-void ListStackTest() {
-    std::cout << "ListStack tests: ";
-    ListStack<int> st;
-    st.Push(3);
-    st.Push(2);
-    assert(st.Top() == 2);
-    assert(st.Pop() == 2);
-    assert(st.Get(0) == 3);
-    std::cout << "all tests were completed successfully.\n";
-}
-
-void ArrayDequeTest() {
-    std::cout << "ArrayDeque tests: ";
-    ArrayDeque<int> d;
-    d.PushBack(1);
-    d.PushFront(0);
-    d.PushBack(2);
-    assert(d.Front() == 0);
-    assert(d.Back() == 2);
-    assert(d.PopFront() == 0);
-    assert(d.PopBack() == 2);
-    assert(d.GetLength() == 1);
-    std::cout << "all tests were completed successfully.\n";
-}
-
-void ListDequeTest() {
-    std::cout << "ListDeque tests: ";
-    ListDeque<char> d;
-    d.PushBack('a');
-    d.PushFront('z');
-    d.PushBack('b');
-    assert(d.Front() == 'z');
-    assert(d.Back() == 'b');
-    d.PopBack();
-    assert(d.Back() == 'a');
-    std::cout << "all tests were completed successfully.\n";
-}
-
-void StudentTest() {
-    std::cout << "Student/Professor tests: ";
-    Student s1("Bulgur", 20, 101, "A23-564", true);
-    Student s2("Alexei", 19, 287, "B24-511", true);
-    Student s3("Danila", 17, 543, "S25-801", true);
-
-    ArrayStack<Student> st_st;
-    st_st.Push(s1);
-    st_st.Push(s2);
-    assert(st_st.Top() == s2);
-    assert(st_st.Pop() == s2);
-    assert(st_st.Top() == s1);
-
-
-    ArrayDeque<Student> st_d;
-    st_d.PushBack(s1);
-    st_d.PushFront(s2);
-    st_d.PushBack(s3);
-    assert(st_d.Front() == s2);
-    assert(st_d.Back() == s3);
-    assert(st_d.Get(1) == s1);
-
-
-    ListQueue<Student> st_q;
-    st_q.Enqueue(s1);
-    st_q.Enqueue(s2);
-    assert(st_q.Peek() == s1);
-    assert(st_q.Dequeue() == s1);
-    assert(st_q.Get(0) == s2);
-
-
-    
-
-
-    Student copy = s1;
-    assert(copy == s1);
-    copy.age = 218;
-    assert(!(copy == s1));
-
-
-    Professor p1("Dmitry Victorovich", 52, 102, "Physic", true);
-    Professor p2("Vladimir Vladimirovich", 30, 1, "PATD", true);
-    Professor p3("Tatyana Dmitrievna", 42, 143, "History", false);
-
-    ListStack<Professor> pr_st;
-    pr_st.Push(p1);
-    pr_st.Push(p2);
-    assert(pr_st.Top() == p2);
-    assert(pr_st.Pop() == p2);
-    assert(pr_st.Top() == p1);
-
-
-    ArrayDeque<Professor> pr_d;
-    pr_d.PushBack(p1);
-    pr_d.PushFront(p2);
-    pr_d.PushBack(p3);
-    assert(pr_d.Front() == p2);
-    assert(pr_d.Back() == p3);
-    assert(pr_d.Get(1) == p1);
-
-
-    ListQueue<Professor> pr_q;
-    pr_q.Enqueue(p1);
-    pr_q.Enqueue(p2);
-    assert(pr_q.Peek() == p1);
-    assert(pr_q.Dequeue() == p1);
-    assert(pr_q.Get(0) == p2);
-
-
-    std::cout << "all tests were completed successfully.\n";
-}
-
-void TimeTest() {
-    ArrayStack<int> as;
-
-    auto t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        as.Push(i);
-    }
-    auto t2 = std::chrono::high_resolution_clock::now();
-
-    double time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ArrayStack Push time: " << time_range << std::endl;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        as.Pop();
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ArrayStack Pop time: " << time_range << std::endl << std::endl;
-
-
-    ListStack<int> ls;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        ls.Push(i);
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ListStack Push time: " << time_range << std::endl;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        ls.Pop();
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ListStack Pop time: " << time_range << std::endl << std::endl;
-
-
-    ArrayQueue<int> aq;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        aq.Enqueue(i);
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ArrayQueue Enqueue time: " << time_range << std::endl;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        aq.Dequeue();
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ArrayQueue Dequeue time: " << time_range << std::endl << std::endl;
-
-
-    ListQueue<int> lq;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        lq.Enqueue(i);
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ListQueue Enqueue time: " << time_range << std::endl;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        lq.Dequeue();
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ListQueue Dequeue time: " << time_range << std::endl << std::endl;
-
-
-    ArrayDeque<int> ad;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        ad.PushFront(i);
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ArrayDeque PushFront time : " << time_range << std::endl;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        ad.PopFront();
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ArrayDeque PopFront time : " << time_range << std::endl << std::endl;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        ad.PushBack(i);
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ArrayDeque PushBack time : " << time_range << std::endl;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        ad.PopBack();
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ArrayDeque PopBack time : " << time_range << std::endl << std::endl;
-
-
-    ListDeque<int> ld;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        ld.PushFront(i);
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ListDeque PushFront time : " << time_range << std::endl;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        ld.PopFront();
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ListDeque PopFront time : " << time_range << std::endl << std::endl;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        ld.PushBack(i);
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ListDeque PushBack time : " << time_range << std::endl;
-
-    t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < 1000; i++) {
-        ld.PopBack();
-    }
-    t2 = std::chrono::high_resolution_clock::now();
-
-    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
-
-    std::cout << "ListDeque PopBack time : " << time_range << std::endl << std::endl;
-}
-
-void AllTests() {
-
-    DynamicArrayTest();
-    LinkedListTest();
-
-    ArraySequenceTest();
-    ListSequenceTest();
-
-    ArrayQueueTest();
-    ListQueueTest();
-
-    ArrayStackTest();
-    ListStackTest();
-
-    ArrayDequeTest();
-    ListDequeTest();
-
-    StudentTest();
+#pragma once
+
+#include <assert.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+#include "DynamicArray.hpp"
+#include "LinkedList.hpp"
+#include "ArraySequence.hpp"
+#include "ListSequence.hpp"
+
+#include "Stack.hpp"
+#include "Queue.hpp"
+#include "Deque.hpp"
+
+#include "StaticSequence.hpp"
+#include "CoreContainers.hpp"
+
+#include "User.hpp"
+#include "StudentTable.hpp"
+#include "Kernels.hpp"
+#include "Parallel.hpp"
+#include "View.hpp"
+#include "HashIndex.hpp"
+#include "TreapSequence.hpp"
+#include "GapBufferSequence.hpp"
+#include "StaticContainers.hpp"
+#include "MemoryResource.hpp"
+#include "MmapDynamicArray.hpp"
+#include "Serialize.hpp"
+#include "CsvLoader.hpp"
+#include "Interface.hpp"
+#include "Dump.hpp"
+#include "ConcurrentAppendSequence.hpp"
+#include "ConcurrentArraySequence.hpp"
+
+
+void DynamicArrayTest() {
+    std::cout << "DynamicArray tests: ";
+    DynamicArray<int> arr(3);
+    arr.Set(0, 10);
+    arr.Set(1, 20);
+    arr.Set(2, 30);
+
+    DynamicArray<int> expected1(3);
+    expected1.Set(0, 10);
+    expected1.Set(1, 20);
+    expected1.Set(2, 30);
+    assert(arr == expected1);
+
+    arr.Resize(5);
+    assert(arr.GetSize() == 5);
+
+    arr.Resize(2);
+    DynamicArray<int> expected2(2);
+    expected2.Set(0, 10);
+    expected2.Set(1, 20);
+    assert(arr == expected2);
+
+    arr.Remove(1);
+    assert(arr.GetSize() == 1);
+
+    assert(arr.IsInline() && arr.GetCapacity() == 16);
+    arr.Resize(16);
+    assert(arr.IsInline() && arr.Get(0) == 10);
+    arr.Resize(17);
+    assert(!arr.IsInline() && arr.GetCapacity() == 17 && arr.Get(0) == 10);
+    const int* heapData = arr.Data();
+    DynamicArray<int> moved(std::move(arr));
+    assert(moved.Data() == heapData && arr.GetSize() == 0 && arr.IsInline());
+    arr = moved;
+    assert(arr == moved && arr.Data() != heapData);
+
+    DynamicArray<std::string> words(3);
+    words.Set(0, "alpha");
+    words.Set(2, "gamma");
+    DynamicArray<std::string> wordsMoved(std::move(words));
+    assert(wordsMoved.IsInline() && wordsMoved.Get(0) == "alpha" && wordsMoved.Get(2) == "gamma");
+    assert(words.GetSize() == 0);
+    wordsMoved.Resize(40);
+    wordsMoved.Remove(0);
+    assert(!wordsMoved.IsInline() && wordsMoved.GetSize() == 39 && wordsMoved.Get(1) == "gamma");
+    words = std::move(wordsMoved);
+    assert(words.Get(1) == "gamma" && wordsMoved.GetSize() == 0);
+
+    DynamicArray<int, Checked, 0> heapOnly(2);
+    assert(!heapOnly.IsInline() && heapOnly.GetCapacity() == 2);
+
+    MutableArraySequence<int> seq;
+    for (int i = 0; i < 40; i++) seq.Append(i);
+    MutableArraySequence<int> seqMoved(std::move(seq));
+    assert(seq.GetLength() == 0 && seqMoved.GetLength() == 40 && seqMoved.Get(39) == 39);
+    seq = seqMoved;
+    seq.Append(40);
+    assert(seq.GetLength() == 41 && seqMoved.GetLength() == 40);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void LinkedListTest() {
+    std::cout << "LinkedList tests: ";
+    LinkedList<int> list;
+    list.Append(1);
+    list.Append(2);
+    list.Prepend(0);
+
+    assert(list.GetLength() == 3);
+    assert(list.GetFirst() == 0);
+    assert(list.GetLast() == 2);
+    assert(list.Get(1) == 1);
+
+
+    list.InsertAt(5, 1);
+    assert(list.Get(1) == 5);
+    assert(list.Get(2) == 1);
+
+    LinkedList<int>* sub = list.GetSubList(1, 2);
+    assert(sub->GetLength() == 2);
+    assert(sub->Get(0) == 5);
+    assert(sub->Get(1) == 1);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ArraySequenceTest() {
+    std::cout << "ArraySequence tests: ";
+    MutableArraySequence<int> seq;
+    seq.Append(1);
+    seq.Append(2);
+    seq.Prepend(0);
+
+    assert(seq.GetLength() == 3);
+    assert(seq.Get(0) == 0);
+    assert(seq.Get(2) == 2);
+
+    seq.InsertAt(5, 1);
+    assert(seq.Get(1) == 5);
+    assert(seq.Get(2) == 1);
+
+    auto sub = seq.GetSubsequence(1, 3);
+    assert(sub->GetLength() == 3);
+    assert(sub->Get(0) == 5);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ListSequenceTest() {
+    std::cout << "ListSequence tests: ";
+
+    MutableListSequence<int> seq;
+    seq.Append(1);
+    seq.Append(2);
+    seq.Prepend(0);
+
+    assert(seq.GetLength() == 3);
+    assert(seq.Get(0) == 0);
+    assert(seq.Get(2) == 2);
+
+    seq.InsertAt(5, 1);
+    assert(seq.Get(1) == 5);
+    assert(seq.Get(2) == 1);
+
+    auto sub = seq.GetSubsequence(1, 3);
+    assert(sub->GetLength() == 3);
+    assert(sub->Get(0) == 5);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ArrayQueueTest() {
+    std::cout << "ArrayQueue tests: ";
+    ArrayQueue<int> q;
+    q.Enqueue(1);
+    q.Enqueue(2);
+    q.Enqueue(3);
+    assert(q.GetLength() == 3);
+    assert(q.Peek() == 1);
+    assert(q.Dequeue() == 1);
+    assert(q.Get(0) == 2);
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ListQueueTest() {
+    std::cout << "ListQueue tests: ";
+    ListQueue<int> q;
+    q.Enqueue(10);
+    q.Enqueue(20);
+    q.Enqueue(30);
+    assert(q.GetLength() == 3);
+    assert(q.Peek() == 10);
+    assert(q.Dequeue() == 10);
+    assert(q.Get(0) == 20);
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ArrayStackTest() {
+    std::cout << "ArrayStack tests: ";
+    ArrayStack<std::string> st;
+    st.Push("hello");
+    st.Push("world");
+    assert(st.Top() == "world");
+    assert(st.Pop() == "world");
+    assert(st.Top() == "hello");
+    assert(st.GetLength() == 1);
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ListStackTest() {
+    std::cout << "ListStack tests: ";
+    ListStack<int> st;
+    st.Push(3);
+    st.Push(2);
+    assert(st.Top() == 2);
+    assert(st.Pop() == 2);
+    assert(st.Get(0) == 3);
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ArrayDequeTest() {
+    std::cout << "ArrayDeque tests: ";
+    ArrayDeque<int> d;
+    d.PushBack(1);
+    d.PushFront(0);
+    d.PushBack(2);
+    assert(d.Front() == 0);
+    assert(d.Back() == 2);
+    assert(d.PopFront() == 0);
+    assert(d.PopBack() == 2);
+    assert(d.GetLength() == 1);
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ListDequeTest() {
+    std::cout << "ListDeque tests: ";
+    ListDeque<char> d;
+    d.PushBack('a');
+    d.PushFront('z');
+    d.PushBack('b');
+    assert(d.Front() == 'z');
+    assert(d.Back() == 'b');
+    d.PopBack();
+    assert(d.Back() == 'a');
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void StudentTest() {
+    std::cout << "Student/Professor tests: ";
+    Student s1("Bulgur", 20, 101, "A23-564", true);
+    Student s2("Alexei", 19, 287, "B24-511", true);
+    Student s3("Danila", 17, 543, "S25-801", true);
+
+    ArrayStack<Student> st_st;
+    st_st.Push(s1);
+    st_st.Push(s2);
+    assert(st_st.Top() == s2);
+    assert(st_st.Pop() == s2);
+    assert(st_st.Top() == s1);
+
+
+    ArrayDeque<Student> st_d;
+    st_d.PushBack(s1);
+    st_d.PushFront(s2);
+    st_d.PushBack(s3);
+    assert(st_d.Front() == s2);
+    assert(st_d.Back() == s3);
+    assert(st_d.Get(1) == s1);
+
+
+    ListQueue<Student> st_q;
+    st_q.Enqueue(s1);
+    st_q.Enqueue(s2);
+    assert(st_q.Peek() == s1);
+    assert(st_q.Dequeue() == s1);
+    assert(st_q.Get(0) == s2);
+
+
+    
+
+
+    Student copy = s1;
+    assert(copy == s1);
+    copy.age = 218;
+    assert(!(copy == s1));
+
+
+    Professor p1("Dmitry Victorovich", 52, 102, "Physic", true);
+    Professor p2("Vladimir Vladimirovich", 30, 1, "PATD", true);
+    Professor p3("Tatyana Dmitrievna", 42, 143, "History", false);
+
+    ListStack<Professor> pr_st;
+    pr_st.Push(p1);
+    pr_st.Push(p2);
+    assert(pr_st.Top() == p2);
+    assert(pr_st.Pop() == p2);
+    assert(pr_st.Top() == p1);
+
+
+    ArrayDeque<Professor> pr_d;
+    pr_d.PushBack(p1);
+    pr_d.PushFront(p2);
+    pr_d.PushBack(p3);
+    assert(pr_d.Front() == p2);
+    assert(pr_d.Back() == p3);
+    assert(pr_d.Get(1) == p1);
+
+
+    ListQueue<Professor> pr_q;
+    pr_q.Enqueue(p1);
+    pr_q.Enqueue(p2);
+    assert(pr_q.Peek() == p1);
+    assert(pr_q.Dequeue() == p1);
+    assert(pr_q.Get(0) == p2);
+
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void TryApiTest() {
+    std::cout << "Try API tests: ";
+    DynamicArray<int> arr(2);
+    arr.Set(0, 7);
+    assert(arr.TryGet(0).Value() == 7);
+    assert(arr.TryGet(2).Code() == ErrorCode::INDEX_OUT_OF_RANGE);
+
+    LinkedList<int> list;
+    assert(list.TryGetFirst().Code() == ErrorCode::EMPTY_LIST);
+    list.Append(4);
+    assert(list.TryGetLast().Value() == 4);
+
+    ArrayStack<int> st;
+    assert(!st.TryPop());
+    assert(st.TryTop().Code() == ErrorCode::EMPTY_STACK);
+    st.Push(1);
+    assert(st.TryPop().Value() == 1);
+    assert(st.IsEmpty());
+
+    ArrayQueue<int> aq;
+    assert(aq.TryDequeue().Code() == ErrorCode::EMPTY_ARRAY);
+    aq.Enqueue(1);
+    aq.Enqueue(2);
+    assert(aq.TryDequeue().Value() == 1);
+    assert(aq.TryPeek().Value() == 2);
+
+    ListQueue<int> lq;
+    assert(lq.TryDequeue().Code() == ErrorCode::EMPTY_LIST);
+    lq.Enqueue(3);
+    assert(lq.TryDequeue().ValueOr(0) == 3);
+    assert(lq.TryDequeue().ValueOr(-1) == -1);
+
+    ListDeque<int> ld;
+    assert(ld.TryPopBack().Code() == ErrorCode::EMPTY_LIST);
+    ld.PushFront(1);
+    ld.PushBack(2);
+    assert(ld.TryPopBack().Value() == 2);
+    assert(ld.TryPopFront().Value() == 1);
+    assert(ld.IsEmpty());
+
+    ArrayDeque<int> ad;
+    assert(ad.TryFront().Code() == ErrorCode::EMPTY_ARRAY);
+    ad.PushBack(5);
+    assert(ad.TryBack().Value() == 5);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ErrorTest() {
+    std::cout << "Error tests: ";
+    static_assert(ErrorMessage(ErrorCode::EMPTY_STACK) == "Empty stack");
+
+    try {
+        DynamicArray<int> arr(1);
+        arr.Get(3);
+        assert(false);
+    }
+    catch (const Errors::OutOfRangeError& e) {
+        assert(e.Code() == ErrorCode::INDEX_OUT_OF_RANGE);
+        assert(std::string(e.what()) == "Index out of range");
+    }
+
+    Errors::InvalidArgumentError custom = Errors::InvalidArgument("menu choice");
+    Errors::InvalidArgumentError copy = custom;
+    assert(std::string(copy.what()) == "Invalid argument: menu choice");
+
+    try {
+        MutableArraySequence<int> empty;
+        empty.GetFirst();
+        assert(false);
+    }
+    catch (const std::out_of_range& e) {
+        assert(std::string(e.what()) == "Empty array");
+    }
+    try {
+        Errors::Throw(ErrorCode::IMMUTABLE);
+    }
+    catch (const std::logic_error& e) {
+        assert(std::string(e.what()) == "Immutable object");
+    }
+    try {
+        throw Errors::IoError("disk");
+    }
+    catch (const std::exception& e) {
+        assert(std::string(e.what()) == "Input/output error: disk");
+    }
+
+    std::string longMessage(300, 'x');
+    std::string cut = Errors::InvalidArgument(longMessage).what();
+    assert(cut.size() == 127);
+    assert(cut.compare(0, 20, "Invalid argument: xx") == 0);
+    assert(cut.compare(124, 3, "...") == 0);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void BoundsPolicyTest() {
+    std::cout << "Bounds policy tests: ";
+    DynamicArray<int, Unchecked> raw(3);
+    for (int i = 0; i < raw.GetSize(); i++) raw[i] = i * 2;
+    assert(raw.Get(2) == 4);
+    assert(raw.TryGet(3).Code() == ErrorCode::INDEX_OUT_OF_RANGE);
+
+    MutableArraySequence<int, Unchecked> fast;
+    for (int i = 0; i < 100; i++) fast.Append(i);
+    long long sum = 0;
+    for (int i = 0; i < fast.GetLength(); i++) sum += fast.Get(i);
+    assert(sum == 4950);
+
+    LinkedList<int, DebugAssert> list;
+    list.Append(1);
+    list.Append(2);
+    assert(list.Get(1) == 2);
+
+    MutableListSequence<int, Unchecked> listSeq;
+    listSeq.Append(3);
+    assert(listSeq.GetFirst() == 3);
+
+    MutableArraySequence<int> checked;
+    checked.Append(1);
+    bool thrown = false;
+    try { checked.Get(1); }
+    catch (const Errors::OutOfRangeError&) { thrown = true; }
+    assert(thrown);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void StaticSequenceTest() {
+    std::cout << "Static sequence tests: ";
+    ArrayCore<int> arr;
+    arr.Append(1).Append(2).Prepend(0).InsertAt(5, 1);
+    assert(arr.GetLength() == 4);
+    assert(arr.Get(1) == 5);
+    assert(arr.GetLast() == 2);
+    arr.Remove(1);
+    assert(arr.GetSubsequence(1, 2).GetFirst() == 1);
+    assert(arr.Concat(arr).GetLength() == 6);
+
+    CountingResource counting(std::pmr::new_delete_resource());
+    ArrayCore<int> sorted(&counting);
+    for (int i = 100; i > 0; i--) sorted.Append(i);
+    sorted.Sort();
+    assert(sorted.GetFirst() == 1 && sorted.GetLast() == 100);
+    assert(counting.GetBytesInUse() > 0);
+
+    ListCore<int> list;
+    list.Append(2).Prepend(1);
+    assert(list.Concat(list).Get(3) == 2);
+    assert(list.TryGet(5).Code() == ErrorCode::INDEX_OUT_OF_RANGE);
+
+    SequenceAdapter<ArrayCore<int>> erased(arr);
+    Sequence<int>* seq = &erased;
+    seq->Append(9);
+    assert(seq->GetLast() == 9);
+    Sequence<int>* sub = seq->GetSubsequence(0, 1);
+    assert(sub->GetLength() == 2);
+    delete sub;
+
+    SequenceAdapter<CoreStack<ArrayCore<int>>> stackSeq;
+    for (int i = 0; i < 5; i++) stackSeq.Unwrap().Push(i);
+    Sequence<int>* stackSub = stackSeq.GetSubsequence(1, 3);
+    assert(stackSub->GetLength() == 3 && stackSub->Get(0) == 1);
+    Sequence<int>* stackJoined = stackSeq.Concat(&stackSeq);
+    assert(stackJoined->GetLength() == 10 && stackJoined->Get(5) == 0);
+    MutableListSequence<int> listTail;
+    listTail.Append(7);
+    listTail.Append(8);
+    Sequence<int>* mixed = stackSeq.Concat(&listTail);
+    assert(mixed->GetLength() == 7 && mixed->Get(5) == 7 && mixed->GetLast() == 8);
+    delete stackSub;
+    delete stackJoined;
+    delete mixed;
+
+    SequenceAdapter<CoreQueue<ListCore<int>>> queueSeq;
+    queueSeq.Unwrap().Enqueue(1);
+    queueSeq.Unwrap().Enqueue(2);
+    Sequence<int>* queueJoined = queueSeq.Concat(&erased);
+    assert(queueJoined->GetLength() == 2 + erased.GetLength() && queueJoined->Get(2) == erased.Get(0));
+    Sequence<int>* queueSub = queueSeq.GetSubsequence(1, 1);
+    assert(queueSub->GetFirst() == 2);
+    delete queueJoined;
+    delete queueSub;
+
+    SequenceAdapter<CoreDeque<ArrayCore<int, Checked, DynamicArray<int, Checked, 0>>>> dequeSeq;
+    dequeSeq.Unwrap().PushBack(2);
+    dequeSeq.Unwrap().PushFront(1);
+    Sequence<int>* dequeSub = dequeSeq.GetSubsequence(0, 1);
+    Sequence<int>* dequeJoined = dequeSeq.Concat(&dequeSeq);
+    Sequence<int>* dequeClone = dequeSeq.Clone();
+    assert(dequeSub->GetLast() == 2 && dequeJoined->Get(2) == 1 && dequeClone->GetLength() == 2);
+    delete dequeSub;
+    delete dequeJoined;
+    delete dequeClone;
+
+    CoreStack<ArrayCore<int>> st;
+    st.Push(1);
+    st.Push(2);
+    assert(st.Pop() == 2);
+    assert(st.TryTop().Value() == 1);
+
+    CoreQueue<ListCore<Student>> q;
+    q.Enqueue(Student("Bulgur", 20, 101, "A23-564", true));
+    assert(q.Peek().id == 101);
+    assert(q.Dequeue().name == "Bulgur");
+    assert(q.TryDequeue().Code() == ErrorCode::EMPTY_LIST);
+
+    CoreDeque<ArrayCore<int>> d;
+    d.PushBack(1);
+    d.PushFront(0);
+    assert(d.PopBack() == 1);
+    assert(d.Front() == 0);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ReferenceAccessTest() {
+    std::cout << "Reference access tests: ";
+    DynamicArray<int> arr(2);
+    arr.Set(0, 1);
+    *arr.GetRef(0) = 5;
+    arr.At(1) = 6;
+    assert(arr.Get(0) == 5 && arr.Get(1) == 6);
+
+    LinkedList<int> list;
+    list.Append(1);
+    list.Append(2);
+    list.At(1) = 3;
+    assert(*list.GetRef(1) == 3);
+    assert(list.GetLast() == 3);
+
+    MutableArraySequence<Student> students;
+    students.Append(Student("Bulgur", 20, 101, "A23-564", true));
+    students.At(0).age = 21;
+    assert(&students.At(0) == students.GetRef(0));
+    assert(students.Get(0).age == 21);
+
+    const Sequence<Student>& erased = students;
+    assert(erased.At(0).name == "Bulgur");
+
+    ArrayStack<std::string> st;
+    st.Push("hello");
+    const std::string& top = st.Top();
+    assert(&top == &st.Top());
+
+    ListQueue<int> q;
+    q.Enqueue(1);
+    q.Enqueue(2);
+    assert(q.Front() == 1 && q.Back() == 2 && q.Peek() == 1);
+
+    ListDeque<int> d;
+    d.PushBack(1);
+    d.PushBack(2);
+    assert(d.Back() == 2);
+    d.PopBack();
+    assert(d.Back() == 1);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void StudentTableTest() {
+    std::cout << "StudentTable tests: ";
+    MutableArraySequence<Student> roster;
+    roster.Append(Student("Bulgur", 20, 101, "A23-564", true));
+    roster.Append(Student("Alexei", 19, 287, "B24-511", false));
+    roster.Append(Student("Danila", 17, 543, "A23-564", true));
+
+    StudentTable table(roster);
+    for (int i = 0; i < 100; i++) table.Append(Student("Filler", 30, 1000 + i, "B24-511", i % 2 == 0));
+
+    assert(table.GetLength() == 103);
+    assert(table.GetRow(1) == roster.Get(1));
+    assert(table.Age(2) == 17);
+    assert(table.FindId(543) == 2);
+    assert(table.CountPassed() == 52);
+
+    MutableArraySequence<int> passedA = table.PassedRowsInGroup("A23-564");
+    assert(passedA.GetLength() == 2 && passedA.Get(1) == 2);
+
+    MutableArraySequence<int> young = table.WhereAge([](int age) { return age < 20; });
+    assert(young.GetLength() == 2);
+
+    table.SetExamPass(1, true);
+    assert(table.PassedRows().Get(1) == 1);
+    assert(table.ToSequence().Get(0) == roster.Get(0));
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void StringPoolTest() {
+    std::cout << "StringPool tests: ";
+    StringPool pool;
+    int a = pool.Intern("A23-564");
+    int b = pool.Intern(std::string("B24-511"));
+    assert(a != b);
+    assert(pool.Intern("A23-564") == a);
+    assert(pool.Lookup(b) == "B24-511");
+    assert(pool.Find("C00-000") == -1);
+    assert(pool.GetSize() == 2);
+
+    Student plain("Bulgur", 20, 101, "A23-564", true);
+    InternedStudent s1(plain);
+    InternedStudent s2("Bulgur", 20, 101, "A23-564", true);
+    assert(s1 == s2);
+    assert(s1.Group() == "A23-564");
+    assert(s1.ToStudent() == plain);
+
+    InternedProfessor p1("Dmitry Victorovich", 52, 102, "Physic", true);
+    InternedProfessor p2(Professor("Dmitry Victorovich", 52, 102, "History", true));
+    assert(!(p1 == p2));
+    assert(p2.Subject() == "History");
+
+    StudentTable table;
+    table.Append(plain);
+    table.Append(s2);
+    table.Append(Student("Alexei", 19, 287, "B24-511", true));
+    assert(table.GroupId(0) == table.GroupId(1));
+    assert(table.GetInternedRow(1) == s1);
+    DynamicArray<int> byGroup = table.CountPassedByGroup();
+    assert(byGroup.Get(GroupPool().Find("A23-564")) == 2);
+    assert(byGroup.Get(GroupPool().Find("B24-511")) == 1);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void KernelsTest() {
+    std::cout << "Kernels tests: ";
+    for (int count = 1; count < 70; count++) {
+        MutableArraySequence<int> ints;
+        MutableArraySequence<double> doubles;
+        for (int i = 0; i < count; i++) {
+            ints.Append((i * 7919) % 23 - 11);
+            doubles.Append(((i * 7919) % 23 - 11) * 0.5);
+        }
+        const int* ip = ints.Data();
+        const double* dp = doubles.Data();
+
+        assert(Kernels::Sum(ints) == Simd::Scalar::Sum(ip, count));
+        assert(Kernels::Sum(doubles) == Simd::Scalar::Sum(dp, count));
+        assert(Kernels::Min(ints) == Simd::Scalar::Min(ip, count));
+        assert(Kernels::Max(doubles) == Simd::Scalar::Max(dp, count));
+        assert(Kernels::IndexOf(ints, ints.GetLast()) == Simd::Scalar::IndexOf(ip, count, ints.GetLast()));
+        assert(Kernels::IndexOf(doubles, 100.0) == -1);
+        for (int op = 0; op < 6; op++) {
+            Kernels::Compare cmp = static_cast<Kernels::Compare>(op);
+            assert(Kernels::CountIf(ints, cmp, 0) == Simd::Scalar::CountIf(ip, count, cmp, 0));
+            assert(Kernels::CountIf(doubles, cmp, 0.5) == Simd::Scalar::CountIf(dp, count, cmp, 0.5));
+        }
+
+        DynamicArray<int> a(const_cast<int*>(ip), count);
+        DynamicArray<int> b(a);
+        assert(a == b);
+        b.At(count - 1)++;
+        assert(!(a == b));
+        assert(Kernels::Equal(doubles, doubles));
+    }
+
+    DynamicArray<long long> wide(3);
+    wide.At(0) = 1LL << 40; wide.At(1) = -5; wide.At(2) = 7;
+    assert(Kernels::Sum(wide) == (1LL << 40) + 2);
+    assert(Kernels::Min(wide) == -5);
+    assert(Kernels::IndexOf(wide, 7LL) == 2);
+
+    MutableArraySequence<int> empty;
+    assert(Kernels::Sum(empty) == 0);
+    try {
+        Kernels::Max(empty);
+        assert(false);
+    }
+    catch (const Errors::OutOfRangeError& e) {
+        assert(e.Code() == ErrorCode::EMPTY_ARRAY);
+    }
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ParallelTest() {
+    std::cout << "Parallel tests: ";
+    ThreadPool pool(4);
+    const int count = 100003;
+    MutableArraySequence<int> arr;
+    MutableListSequence<int> list;
+    for (int i = 0; i < count; i++) {
+        arr.Append(i);
+        if (i < 2000) list.Append(i);
+    }
+
+    MutableArraySequence<long long> squares = Parallel::Map(arr, [](int x) { return (long long)x * x; }, pool);
+    assert(squares.GetLength() == count);
+    for (int i = 0; i < count; i += 997) assert(squares.Get(i) == (long long)i * i);
+
+    MutableArraySequence<int> odd = Parallel::Where(arr, [](int x) { return x % 2 == 1; }, pool);
+    assert(odd.GetLength() == count / 2);
+    for (int i = 0; i < odd.GetLength(); i++) assert(odd.Get(i) == 2 * i + 1);
+
+    long long sum = Parallel::Reduce<long long>(squares, 0, [](long long a, long long b) { return a + b; }, pool);
+    long long expected = 0;
+    for (int i = 0; i < count; i++) expected += (long long)i * i;
+    assert(sum == expected);
+    assert(Parallel::Reduce(arr, 0, [](int a, int b) { return a > b ? a : b; }, pool) == count - 1);
+
+    MutableArraySequence<int> shifted = Parallel::Map(list, [](int x) { return x + 1; }, pool);
+    MutableArraySequence<int> zipped = Parallel::Zip(arr, shifted, [](int a, int b) { return b - a; }, pool);
+    assert(zipped.GetLength() == 2000 && Parallel::Where(zipped, [](int x) { return x != 1; }).GetLength() == 0);
+    MutableArraySequence<std::pair<int, int>> pairs = Parallel::Zip(list, arr, pool);
+    assert(pairs.GetLength() == 2000 && pairs.Get(1999) == std::make_pair(1999, 1999));
+
+    MutableArraySequence<int> empty;
+    assert(Parallel::Map(empty, [](int x) { return x; }, pool).GetLength() == 0);
+    assert(Parallel::Where(empty, [](int) { return true; }, pool).GetLength() == 0);
+    assert(Parallel::Reduce(empty, 7, [](int a, int b) { return a + b; }, pool) == 7);
+
+    bool thrown = false;
+    try {
+        Parallel::Map(arr, [](int x) { if (x == count - 1) throw Errors::InvalidArgument(); return x; }, pool);
+    }
+    catch (const Errors::InvalidArgumentError&) { thrown = true; }
+    assert(thrown);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ViewTest() {
+    std::cout << "View tests: ";
+    int items[] = { 5, 1, 8, 3, 9, 2, 7 };
+    MutableArraySequence<int> arr(items, 7);
+    MutableListSequence<int> list(items, 7);
+    DynamicArray<int> dyn(items, 7);
+    LinkedList<int> linked(items, 7);
+
+    MutableArraySequence<int> big = View::From(arr).Where([](int x) { return x > 4; }).Map([](int x) { return x * 10; }).ToArraySequence();
+    assert(big.GetLength() == 4 && big.Get(0) == 50 && big.Get(3) == 70);
+
+    const Sequence<int>& erased = list;
+    MutableListSequence<int> sliced = View::From(erased).Slice(1, 3).ToListSequence();
+    assert(sliced.GetLength() == 3 && sliced.Get(0) == 1 && sliced.Get(2) == 3);
+    assert(View::From(arr).Slice(5, 100).Count() == 2);
+    assert(View::From(linked).Skip(2).Take(2).Reduce(0, [](int a, int b) { return a + b; }) == 11);
+
+    int visited = 0;
+    int firstTwo = View::From(dyn).Map([&visited](int x) { visited++; return x; }).Take(2).Reduce(0, [](int a, int b) { return a + b; });
+    assert(firstTwo == 6 && visited == 2);
+
+    MutableArraySequence<int> joined = View::From(arr).Take(2).Concat(View::From(linked).Skip(5)).ToArraySequence();
+    assert(joined.GetLength() == 4 && joined.Get(1) == 1 && joined.Get(2) == 2 && joined.Get(3) == 7);
+
+    SequenceAdapter<ArrayCore<int>> adapter(ArrayCore<int>(items, 7));
+    const Sequence<int>& generic = adapter;
+    assert(View::From(generic).Where([](int x) { return x % 2 == 0; }).Count() == 2);
+
+    MutableArraySequence<std::string> names = View::From(list).Where([](int x) { return x < 3; })
+        .Map([](int x) { return std::string(x, '*'); }).ToArraySequence();
+    assert(names.GetLength() == 2 && names.Get(0) == "*" && names.Get(1) == "**");
+
+    bool thrown = false;
+    try {
+        View::From(arr).Take(-1);
+    }
+    catch (const Errors::InvalidArgumentError&) { thrown = true; }
+    assert(thrown);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void SortTest() {
+    std::cout << "Sort tests: ";
+    unsigned seed = 12345;
+    auto next = [&seed]() { seed = seed * 1103515245u + 12345u; return int(seed >> 8) % 2001 - 1000; };
+
+    for (int count : { 0, 1, 2, 17, 1000, 200000 }) {
+        MutableArraySequence<int> arr(count);
+        for (int i = 0; i < count; i++) arr.At(i) = next();
+        MutableArraySequence<int> byKey(arr);
+        MutableArraySequence<int> parallel(arr);
+        long long sum = Kernels::Sum(arr);
+
+        arr.Sort();
+        byKey.SortByKey([](int x) { return x; });
+        ThreadPool pool(4);
+        Sorting::ParallelSort(parallel.Data(), count, std::greater<int>(), pool);
+        for (int i = 1; i < count; i++) {
+            assert(arr.Get(i - 1) <= arr.Get(i));
+            assert(parallel.Get(i - 1) >= parallel.Get(i));
+        }
+        assert(Kernels::Equal(arr, byKey));
+        assert(Kernels::Sum(arr) == sum && Kernels::Sum(parallel) == sum);
+    }
+
+    MutableArraySequence<Student> students;
+    for (int i = 0; i < 500; i++)
+        students.Append(Student("Student", 17 + (i * 7) % 5, (i * 389) % 500, "A23-564", true));
+    students.SortByKey([](const Student& s) { return s.id; });
+    students.SortByKey([](const Student& s) { return s.age; });
+    for (int i = 1; i < students.GetLength(); i++) {
+        const Student& a = students.At(i - 1);
+        const Student& b = students.At(i);
+        assert(a.age < b.age || (a.age == b.age && a.id < b.id));
+    }
+    students.Sort([](const Student& a, const Student& b) { return a.id < b.id; });
+    for (int i = 0; i < students.GetLength(); i++) assert(students.At(i).id == i);
+
+    MutableListSequence<std::pair<int, int>> list;
+    for (int i = 0; i < 300; i++) list.Append(std::make_pair(next() % 10, i));
+    list.Sort([](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; });
+    for (int i = 1; i < list.GetLength(); i++) {
+        std::pair<int, int> a = list.Get(i - 1);
+        std::pair<int, int> b = list.Get(i);
+        assert(a.first < b.first || (a.first == b.first && a.second < b.second));
+    }
+    list.Append(std::make_pair(100, 0));
+    assert(list.GetLast().first == 100 && list.GetLength() == 301);
+
+    LinkedList<int> linked;
+    for (int i = 0; i < 5; i++) linked.Prepend(i);
+    const int* first = &linked.At(4);
+    linked.Sort();
+    assert(linked.GetFirst() == 0 && linked.GetLast() == 4 && &linked.At(0) == first);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void HashIndexTest() {
+    std::cout << "HashIndex tests: ";
+    HashIndex<int> index;
+    for (int i = 0; i < 1000; i++) assert(index.Insert(i * 7, i));
+    assert(!index.Insert(14, 99));
+    assert(index.GetSize() == 1000 && index.Find(700) == 100 && index.Find(3) == -1);
+    for (int i = 0; i < 1000; i += 2) assert(index.Erase(i * 7));
+    assert(!index.Erase(0));
+    for (int i = 0; i < 1000; i++) assert(index.Find(i * 7) == (i % 2 ? i : -1));
+
+    HashIndex<std::string> names;
+    names.Insert("Alexei", 0);
+    names.Insert("Bulgur", 1);
+    assert(names.Find("Bulgur") == 1 && names.Find("Dmitry") == -1);
+
+    auto byId = [](const Student& s) { return s.id; };
+    IndexedArraySequence<Student, decltype(byId)> students(byId);
+    for (int i = 0; i < 100; i++) students.Append(Student("Student", 18, 1000 + i, "A23-564", true));
+    students.Prepend(Student("First", 20, 5, "B24-511", false));
+    students.InsertAt(Student("Middle", 21, 6, "B24-511", true), 50);
+    students.Remove(10);
+    assert(students.GetLength() == 101);
+    for (int i = 0; i < students.GetLength(); i++) assert(students.Find(students.At(i).id) == i);
+    assert(students.Find(1009) == -1 && students.FindRef(6)->name == "Middle");
+    assert(students.FindRef(77) == nullptr);
+
+    bool thrown = false;
+    try {
+        students.Append(Student("Copy", 20, 5, "B24-511", false));
+    }
+    catch (const Errors::InvalidArgumentError&) { thrown = true; }
+    assert(thrown && students.GetLength() == 101);
+
+    students.SortByKey([](const Student& s) { return -s.id; });
+    assert(students.Find(5) == 100 && students.FindRef(1099) == &students.At(0));
+
+    Sequence<Student>* copy = students.Clone();
+    auto* indexedCopy = dynamic_cast<IndexedArraySequence<Student, decltype(byId)>*>(copy);
+    assert(indexedCopy && indexedCopy->Find(6) == students.Find(6));
+    delete copy;
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void TreapSequenceTest() {
+    std::cout << "TreapSequence tests: ";
+    int items[] = { 1, 2, 3, 4, 5 };
+    TreapSequence<int> small(items, 5);
+    assert(small.GetLength() == 5 && small.GetFirst() == 1 && small.GetLast() == 5);
+    small.Prepend(0)->Append(6)->InsertAt(42, 3);
+    assert(small.Get(0) == 0 && small.Get(3) == 42 && small.Get(4) == 3 && small.GetLast() == 6);
+    small.Remove(3);
+    assert(small.TryGet(7).Code() == ErrorCode::INDEX_OUT_OF_RANGE);
+
+    TreapSequence<int> treap;
+    MutableArraySequence<int> model;
+    unsigned seed = 99;
+    for (int i = 0; i < 20000; i++) {
+        seed = seed * 1103515245u + 12345u;
+        int position = int(seed >> 8) % (model.GetLength() + 1);
+        treap.InsertAt(i, position);
+        model.InsertAt(i, position);
+    }
+    for (int i = 0; i < 5000; i++) {
+        seed = seed * 1103515245u + 12345u;
+        int position = int(seed >> 8) % model.GetLength();
+        treap.Remove(position);
+        model.Remove(position);
+    }
+    assert(treap.GetLength() == model.GetLength());
+    int position = 0;
+    treap.ForEach([&](int item) { assert(item == model.Get(position++)); });
+
+    for (int first : { 0, 1, 255, 256, 4000 }) {
+        for (int last : { first, first + 1, first + 300, model.GetLength() - 1 }) {
+            if (last >= model.GetLength()) continue;
+            Sequence<int>* range = treap.GetSubsequence(first, last);
+            assert(range->GetLength() == last - first + 1);
+            for (int i = first; i <= last; i++) assert(range->Get(i - first) == model.Get(i));
+            delete range;
+        }
+    }
+
+    // Chunks cut by inserts get their own priorities, so the tree stays
+    // logarithmic instead of collapsing into a list.
+    TreapSequence<int> deep;
+    for (int i = 0; i < 100000; i++) {
+        seed = seed * 1103515245u + 12345u;
+        deep.InsertAt(i, int(seed >> 8) % (deep.GetLength() + 1));
+    }
+    assert(deep.GetHeight() < 60);
+    TreapSequence<int> appended;
+    for (int i = 0; i < 100000; i++) appended.Append(i);
+    assert(appended.GetHeight() < 60 && appended.Get(54321) == 54321);
+    TreapSequence<int>* back = appended.SplitAt(50000);
+    assert(back->GetHeight() < 60 && back->GetFirst() == 50000);
+    delete back;
+
+    Sequence<int>* sub = treap.GetSubsequence(100, 7099);
+    assert(sub->GetLength() == 7000 && sub->Get(0) == model.Get(100) && sub->GetLast() == model.Get(7099));
+    Sequence<int>* joined = treap.Concat(sub);
+    assert(joined->GetLength() == treap.GetLength() + 7000 && joined->Get(treap.GetLength()) == model.Get(100));
+    delete sub;
+    delete joined;
+
+    TreapSequence<int> copy(treap);
+    TreapSequence<int>* tail = copy.SplitAt(6000);
+    assert(copy.GetLength() == 6000 && tail->GetLength() == model.GetLength() - 6000);
+    assert(tail->GetFirst() == model.Get(6000) && copy.GetLast() == model.Get(5999));
+    tail->ConcatInPlace(copy);
+    assert(copy.GetLength() == 0 && tail->GetLength() == model.GetLength());
+    assert(tail->Get(tail->GetLength() - 6000) == model.Get(0));
+    delete tail;
+
+    TreapSequence<std::string> words;
+    words.Append("b");
+    words.Prepend("a");
+    words.At(1) += "!";
+    assert(words.Get(1) == "b!" && words.TryGetFirst().Value() == "a");
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void GapBufferSequenceTest() {
+    std::cout << "GapBufferSequence tests: ";
+    int items[] = { 1, 2, 3, 4, 5 };
+    GapBufferSequence<int> small(items, 5);
+    assert(small.GetLength() == 5 && small.GetFirst() == 1 && small.GetLast() == 5);
+    small.Prepend(0)->Append(6)->InsertAt(42, 3);
+    assert(small.Get(0) == 0 && small.Get(3) == 42 && small.Get(4) == 3 && small.GetLast() == 6);
+    assert(small.GetGapPosition() == 4);
+    small.Remove(3);
+    assert(small.GetGapPosition() == 3 && small.Get(3) == 3);
+    small.Remove(3);
+    assert(small.GetGapPosition() == 3 && small.Get(3) == 4 && small.GetLength() == 6);
+    assert(small.TryGet(6).Code() == ErrorCode::INDEX_OUT_OF_RANGE);
+
+    GapBufferSequence<int> empty;
+    assert(empty.TryGetLast().Code() == ErrorCode::EMPTY_ARRAY);
+    try {
+        empty.Remove(0);
+        assert(false);
+    }
+    catch (const Errors::OutOfRangeError& e) {
+        assert(e.Code() == ErrorCode::EMPTY_ARRAY);
+    }
+
+    GapBufferSequence<int> buffer;
+    MutableArraySequence<int> model;
+    unsigned seed = 17;
+    int cursor = 0;
+    for (int i = 0; i < 20000; i++) {
+        seed = seed * 1103515245u + 12345u;
+        int op = int(seed >> 8) % 10;
+        if (op < 6) {
+            buffer.InsertAt(i, cursor);
+            model.InsertAt(i, cursor);
+            cursor++;
+        }
+        else if (op < 8 && cursor > 0) {
+            cursor--;
+            buffer.Remove(cursor);
+            model.Remove(cursor);
+        }
+        else {
+            cursor = int(seed >> 12) % (model.GetLength() + 1);
+        }
+    }
+    assert(buffer.GetLength() == model.GetLength());
+    for (int i = 0; i < model.GetLength(); i++) assert(buffer.Get(i) == model.Get(i));
+    int position = 0;
+    buffer.ForEach([&](int item) { assert(item == model.Get(position++)); });
+
+    Sequence<int>* sub = buffer.GetSubsequence(10, 109);
+    assert(sub->GetLength() == 100 && sub->Get(0) == model.Get(10) && sub->GetLast() == model.Get(109));
+    Sequence<int>* joined = buffer.Concat(sub);
+    assert(joined->GetLength() == buffer.GetLength() + 100 && joined->Get(buffer.GetLength()) == model.Get(10));
+    delete sub;
+    delete joined;
+
+    MutableArraySequence<int> array;
+    try {
+        buffer.Concat(&array);
+        assert(false);
+    }
+    catch (const Errors::LogicError& e) {
+        assert(e.Code() == ErrorCode::INCOMPATIBLE_TYPES);
+    }
+
+    GapBufferSequence<std::string> words;
+    words.Append("b");
+    words.Prepend("a");
+    words.At(1) += "!";
+    words.InsertAt("c", 1);
+    assert(words.Get(0) == "a" && words.Get(1) == "c" && words.Get(2) == "b!");
+    Sequence<std::string>* wordsCopy = words.Clone();
+    words.Remove(0);
+    assert(wordsCopy->GetLength() == 3 && wordsCopy->GetFirst() == "a" && words.GetFirst() == "c");
+    delete wordsCopy;
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+constexpr int RingCoreCheck() {
+    RingCore<int, 4> ring;
+    ring.PushBack(2);
+    ring.PushBack(3);
+    ring.PushFront(1);
+    ring.PopFront();
+    ring.PushBack(4);
+    ring.PushBack(5);
+    return ring.At(0) * 1000 + ring.At(3) * 100 + ring.GetLength() * 10 + (ring.TryPushFront(0) ? 1 : 0);
+}
+
+void StaticContainersTest() {
+    std::cout << "StaticContainers tests: ";
+    static_assert(RingCoreCheck() == 2540);
+    static_assert(ErrorMessage(ErrorCode::CONTAINER_FULL) == "Container is full");
+
+    int items[] = { 1, 2, 3 };
+    StaticStack<int, 4> stack(items, 3);
+    Stack<int>* st = &stack;
+    assert(st->Top() == 3 && st->GetFirst() == 1 && st->GetLength() == 3);
+    st->Push(4);
+    assert(stack.IsFull() && !stack.TryPush(5));
+    try {
+        st->Push(5);
+        assert(false);
+    }
+    catch (const Errors::RuntimeError& e) {
+        assert(e.Code() == ErrorCode::CONTAINER_FULL);
+    }
+    assert(st->Pop() == 4 && st->Pop() == 3 && st->TryPop().Value() == 2 && st->Pop() == 1);
+    assert(st->TryTop().Code() == ErrorCode::EMPTY_STACK);
+    try {
+        st->Pop();
+        assert(false);
+    }
+    catch (const Errors::RuntimeError& e) {
+        assert(e.Code() == ErrorCode::EMPTY_STACK);
+    }
+
+    StaticQueue<int, 3> queue;
+    Queue<int>* q = &queue;
+    for (int round = 0; round < 10; round++) {
+        q->Enqueue(round);
+        q->Enqueue(round + 100);
+        assert(q->Peek() == round && q->Back() == round + 100 && q->Get(1) == round + 100);
+        assert(q->Dequeue() == round && q->TryDequeue().Value() == round + 100);
+    }
+    assert(q->IsEmpty() && q->TryPeek().Code() == ErrorCode::EMPTY_ARRAY);
+
+    StaticDeque<std::string, 4> deque;
+    Deque<std::string>* d = &deque;
+    d->PushBack("b");
+    d->PushFront("a");
+    d->PushBack("c");
+    d->PushFront("z");
+    assert(deque.IsFull() && !deque.TryPushFront("y"));
+    assert(d->Get(0) == "z" && d->Get(3) == "c" && d->Front() == "z" && d->Back() == "c");
+    assert(d->PopBack() == "c" && d->PopFront() == "z" && d->TryPopFront().Value() == "a");
+    assert(d->TryBack().Value() == "b" && d->GetLength() == 1);
+    StaticDeque<std::string, 4> dequeCopy(deque);
+    d->PopBack();
+    assert(d->TryPopBack().Code() == ErrorCode::EMPTY_ARRAY && dequeCopy.Front() == "b");
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+// Counts live objects and throws once its construction budget runs out.
+struct FragileItem {
+    static inline int budget = -1;
+    static inline int alive = 0;
+    int value = 0;
+
+    static void Spend() {
+        if (budget == 0) throw std::runtime_error("budget spent");
+        if (budget > 0) budget--;
+    }
+    FragileItem() { Spend(); alive++; }
+    FragileItem(const FragileItem& other) : value(other.value) { Spend(); alive++; }
+    FragileItem(FragileItem&& other) : value(other.value) { Spend(); alive++; }
+    FragileItem& operator=(const FragileItem&) = default;
+    ~FragileItem() { alive--; }
+};
+
+void MemoryResourceTest() {
+    std::cout << "MemoryResource tests: ";
+    ArenaResource arena;
+    {
+        MutableListSequence<int> list(&arena);
+        for (int i = 0; i < 1000; i++) list.Append(i);
+        assert(list.GetResource() == &arena && arena.GetBytesUsed() >= 1000 * 2 * sizeof(int));
+        MutableListSequence<int> copy(list);
+        assert(copy.GetResource() == std::pmr::get_default_resource() && copy.Get(999) == 999);
+
+        MutableArraySequence<std::string> words(&arena);
+        for (int i = 0; i < 100; i++) words.Append(std::to_string(i));
+        MutableArraySequence<std::string> fromDefault;
+        fromDefault.Append("x");
+        words = std::move(fromDefault);
+        assert(words.GetResource() == &arena && words.GetLength() == 1 && words.Get(0) == "x");
+
+        ArrayStack<int> stack(&arena);
+        for (int i = 0; i < 100; i++) stack.Push(i);
+        assert(stack.Pop() == 99 && stack.GetResource() == &arena);
+    }
+    arena.Release();
+    assert(arena.GetBytesUsed() == 0);
+
+    alignas(std::max_align_t) char buffer[1024];
+    ArenaResource local(buffer, sizeof(buffer));
+    DynamicArray<int> inBuffer(100, &local);
+    assert((char*)inBuffer.Data() >= buffer && (char*)inBuffer.Data() < buffer + sizeof(buffer));
+    DynamicArray<double> aligned(50, &local);
+    assert(reinterpret_cast<std::uintptr_t>(aligned.Data()) % alignof(double) == 0);
+
+    PoolResource pool;
+    void* first = pool.allocate(24);
+    void* second = pool.allocate(24);
+    assert(first != second && reinterpret_cast<std::uintptr_t>(first) % alignof(std::max_align_t) == 0);
+    pool.deallocate(first, 24);
+    assert(pool.allocate(32) == first);
+    void* large = pool.allocate(4096);
+    pool.deallocate(large, 4096);
+    pool.deallocate(second, 24);
+
+    ListQueue<int> queue(&pool);
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < 50; i++) queue.Enqueue(round * 50 + i);
+        for (int i = 0; i < 50; i++) assert(queue.Dequeue() == round * 50 + i);
+    }
+    assert(queue.IsEmpty());
+
+    CountingResource counting(std::pmr::new_delete_resource());
+    {
+        DynamicArray<FragileItem, Checked, 0> fragile(20, &counting);
+        for (int i = 0; i < 20; i++) fragile[i].value = i;
+        std::size_t before = counting.GetBytesInUse();
+        for (int budget : { 10, 25 }) {
+            FragileItem::budget = budget;
+            bool thrown = false;
+            try { fragile.Resize(40); }
+            catch (const std::runtime_error&) { thrown = true; }
+            FragileItem::budget = -1;
+            assert(thrown && fragile.GetSize() == 20 && FragileItem::alive == 20);
+            assert(counting.GetBytesInUse() == before);
+        }
+        for (int i = 0; i < 20; i++) assert(fragile[i].value == i);
+        fragile.Resize(40);
+        assert(fragile.GetSize() == 40 && FragileItem::alive == 40);
+    }
+    assert(FragileItem::alive == 0 && counting.GetBytesInUse() == 0);
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void MmapDynamicArrayTest() {
+    std::cout << "MmapDynamicArray tests: ";
+    const char* path = "MmapDynamicArrayTest.seq";
+    std::remove(path);
+    {
+        MmapDynamicArray<int> arr(path);
+        assert(arr.GetSize() == 0);
+        arr.Resize(1000);
+        for (int i = 0; i < 1000; i++) arr.Set(i, i * i);
+        arr.Remove(0);
+        arr.Flush();
+        assert(arr.GetSize() == 999 && arr[0] == 1 && arr.GetCapacity() >= 1000);
+    }
+    {
+        MmapDynamicArray<int> arr(path);
+        assert(arr.GetSize() == 999 && arr.Get(998) == 999 * 999 && arr.GetCapacity() == 999);
+        DynamicArray<int>* sub = arr.GetSubArray(0, 2);
+        assert(sub->GetSize() == 3 && sub->Get(2) == 9);
+        delete sub;
+        assert(!arr.TryGet(999));
+        MmapDynamicArray<int> moved(std::move(arr));
+        assert(moved.GetSize() == 999 && moved.GetPath() == path);
+    }
+    {
+        MutableArraySequence<int, Checked, MmapDynamicArray<int>> seq(MmapDynamicArray<int>(path, nullptr, 0));
+        for (int i = 0; i < 100; i++) seq.Append(i);
+        seq.Remove(0);
+        Sequence<int>* sub = seq.GetSubsequence(0, 9);
+        assert(sub->GetLength() == 10 && sub->Get(0) == 1);
+        delete sub;
+        assert(Kernels::Max(seq) == 99 && Kernels::Sum(seq) == 4950);
+    }
+    {
+        MutableArraySequence<int, Checked, MmapDynamicArray<int>> seq(MmapDynamicArray<int>{ path });
+        assert(seq.GetLength() == 99 && seq.GetFirst() == 1 && seq.GetLast() == 99);
+        seq.InsertAt(-5, 10);
+        seq.Prepend(0);
+        seq.Remove(50);
+    }
+    {
+        MutableArraySequence<int, Checked, MmapDynamicArray<int>> seq(MmapDynamicArray<int>{ path });
+        assert(seq.GetLength() == 100 && seq.GetFirst() == 0 && seq.Get(11) == -5 && seq.GetLast() == 99);
+    }
+    {
+        MutableArraySequence<int, Checked, MmapDynamicArray<int>> seq(MmapDynamicArray<int>(path, nullptr, 0));
+        for (int i = 1; i <= 5; i++) seq.Append(i);
+    }
+    {
+        MmapDynamicArray<int> arr(path);
+        assert(arr.GetSize() == 5 && arr.Get(4) == 5);
+        arr.Reserve(1000);
+        assert(arr.GetSize() == 5 && arr.GetCapacity() >= 1000);
+    }
+    {
+        MmapDynamicArray<int> arr(path);
+        assert(arr.GetSize() == 5);
+    }
+    try {
+        MmapDynamicArray<double> wrongType(path);
+        assert(false);
+    }
+    catch (const Errors::InvalidArgumentError& e) {
+        assert(e.Code() == ErrorCode::INVALID_ARGUMENT);
+    }
+    {
+        std::ofstream garbage(path, std::ios::binary | std::ios::trunc);
+        garbage << std::string(100, 'x');
+    }
+    try {
+        MmapDynamicArray<int> notOurs(path);
+        assert(false);
+    }
+    catch (const Errors::InvalidArgumentError&) {}
+    std::remove(path);
+
+    try {
+        MmapDynamicArray<int> missingDirectory("no/such/dir/file.seq");
+        assert(false);
+    }
+    catch (const Errors::RuntimeError& e) {
+        assert(e.Code() == ErrorCode::IO_ERROR);
+    }
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void SerializeTest() {
+    std::cout << "Serialize tests: ";
+    std::stringstream stream;
+    {
+        int numbers[] = { 1, 2, 3, 4, 5 };
+        Serialization::BinaryWriter writer(stream);
+        Serialization::Save(writer, DynamicArray<int>(numbers, 5));
+
+        MutableArraySequence<std::string> words;
+        words.Append("alpha")->Append("")->Append("gamma");
+        Serialization::Save(writer, words);
+
+        LinkedList<Student> students;
+        students.Append(Student("Ann", 19, 1, "B-21", true));
+        students.Append(Student("Bob", 20, 2, "B-22", false));
+        Serialization::Save(writer, students);
+
+        MutableListSequence<Professor> professors;
+        professors.Append(Professor("Kim", 50, 7, "Algebra", true));
+        Serialization::Save(writer, professors);
+
+        ArrayStack<int> stack(numbers, 5);
+        Serialization::Save(writer, stack);
+        ListQueue<User> queue;
+        queue.Enqueue(User("Eve", 30, 3));
+        Serialization::Save(writer, queue);
+        StaticDeque<double, 4> deque;
+        deque.PushBack(1.5);
+        deque.PushFront(0.5);
+        Serialization::Save(writer, deque);
+        TreapSequence<int> treap;
+        for (int i = 0; i < 100; i++) treap.Append(i);
+        Serialization::Save(writer, treap);
+        Serialization::Save(writer, static_cast<const Sequence<int>&>(treap));
+        writer.Flush();
+    }
+    {
+        Serialization::BinaryReader reader(stream);
+        DynamicArray<int> numbers(0);
+        Serialization::Load(reader, numbers);
+        assert(numbers.GetSize() == 5 && numbers[4] == 5);
+
+        MutableArraySequence<std::string> words;
+        Serialization::Load(reader, words);
+        assert(words.GetLength() == 3 && words.Get(1).empty() && words.Get(2) == "gamma");
+
+        LinkedList<Student> students;
+        Serialization::Load(reader, students);
+        assert(students.GetLength() == 2 && students.Get(1) == Student("Bob", 20, 2, "B-22", false));
+
+        MutableListSequence<Professor> professors;
+        Serialization::Load(reader, professors);
+        assert(professors.GetFirst() == Professor("Kim", 50, 7, "Algebra", true));
+
+        ArrayStack<int> stack;
+        Serialization::Load(reader, stack);
+        assert(stack.GetLength() == 5 && stack.Pop() == 5);
+        ListQueue<User> queue;
+        Serialization::Load(reader, queue);
+        assert(queue.Dequeue() == User("Eve", 30, 3));
+        StaticDeque<double, 4> deque;
+        Serialization::Load(reader, deque);
+        assert(deque.GetLength() == 2 && deque.PopFront() == 0.5);
+        TreapSequence<int> treap;
+        Serialization::Load(reader, treap);
+        assert(treap.GetLength() == 100 && treap.Get(99) == 99);
+        MutableListSequence<int> list;
+        Serialization::Load(reader, list);
+        assert(list.GetLength() == 100 && list.Get(42) == 42);
+
+        try {
+            Serialization::Load(reader, numbers);
+            assert(false);
+        }
+        catch (const Errors::RuntimeError& e) {
+            assert(e.Code() == ErrorCode::IO_ERROR);
+        }
+    }
+
+    std::stringstream mismatched;
+    {
+        Serialization::BinaryWriter writer(mismatched);
+        Serialization::Save(writer, DynamicArray<int>(3));
+        Serialization::Save(writer, DynamicArray<int>(3));
+    }
+    Serialization::BinaryReader reader(mismatched);
+    try {
+        DynamicArray<double> floats(0);
+        Serialization::Load(reader, floats);
+        assert(false);
+    }
+    catch (const Errors::InvalidArgumentError&) {}
+    try {
+        MutableListSequence<int> notEmpty;
+        notEmpty.Append(1);
+        Serialization::Load(reader, notEmpty);
+        assert(false);
+    }
+    catch (const Errors::InvalidArgumentError&) {}
+
+    const char* path = "SerializeTest.seqb";
+    MutableArraySequence<long long> big;
+    for (int i = 0; i < 10000; i++) big.Append(i);
+    Serialization::SaveFile(path, big);
+    {
+        Serialization::MappedArray<long long> mapped(path);
+        assert(mapped.GetLength() == 10000 && mapped[9999] == 9999);
+        assert(Kernels::Sum(mapped.Data(), mapped.GetLength()) == 49995000);
+        MutableArraySequence<long long> loaded;
+        Serialization::LoadFile(path, loaded);
+        assert(Kernels::Equal(loaded, big));
+    }
+    try {
+        Serialization::MappedArray<int> wrongType(path);
+        assert(false);
+    }
+    catch (const Errors::InvalidArgumentError&) {}
+    std::remove(path);
+
+    {
+        MutableArraySequence<int> pair;
+        pair.Append(5);
+        pair.Append(7);
+        std::stringstream indexedStream;
+        Serialization::BinaryWriter writer(indexedStream);
+        Serialization::Save(writer, pair);
+        writer.Flush();
+        auto self = [](int x) { return x; };
+        IndexedArraySequence<int, decltype(self)> indexed(self);
+        Serialization::BinaryReader reader(indexedStream);
+        Serialization::Load(reader, indexed);
+        assert(indexed.GetLength() == 2 && indexed.Find(5) == 0 && indexed.Find(7) == 1);
+    }
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void CsvLoaderTest() {
+    std::cout << "CsvLoader tests: ";
+    std::string_view students =
+        "name,age,id,group,exam_pass\n"
+        "Ann,19,1,B-21,1\r\n"
+        "\n"
+        "\"Smith, \"\"Bob\"\"\",20,2,B-22,false\n"
+        "\"Multi\nLine\",21,3,\"B-23\",yes";
+    MutableArraySequence<Student> roster;
+    assert(Csv::Parse(students, roster) == 3);
+    assert(roster.Get(0) == Student("Ann", 19, 1, "B-21", true));
+    assert(roster.Get(1) == Student("Smith, \"Bob\"", 20, 2, "B-22", false));
+    assert(roster.Get(2).name == "Multi\nLine" && roster.Get(2).group == "B-23" && roster.Get(2).exam_pass);
+
+    MutableListSequence<Professor> professors;
+    Csv::Options tsv;
+    tsv.delimiter = '\t';
+    tsv.hasHeader = false;
+    assert(Csv::Parse("Kim\t50\t7\tAlgebra\t1\nLee\t45\t8\t\t0\n", professors, tsv) == 2);
+    assert(professors.GetLast() == Professor("Lee", 45, 8, "", false));
+
+    LinkedList<User> users;
+    Csv::Options noHeader;
+    noHeader.hasHeader = false;
+    Csv::Parse("Eve,30,3\n", users, noHeader);
+    assert(users.GetLength() == 1 && users.Get(0) == User("Eve", 30, 3));
+
+    auto rejects = [&noHeader](std::string_view text) {
+        MutableArraySequence<User> sink;
+        try {
+            Csv::Parse(text, sink, noHeader);
+        }
+        catch (const Errors::InvalidArgumentError&) {
+            return true;
+        }
+        return false;
+    };
+    assert(rejects("Eve,thirty,3\n"));
+    assert(rejects("Eve,30\n"));
+    assert(rejects("Eve,30,3,extra\n"));
+    assert(rejects("\"Eve,30,3\n"));
+    assert(rejects("\"Eve\"x,30,3\n"));
+    assert(rejects("Eve,30,99999999999\n"));
+
+    const char* path = "CsvLoaderTest.csv";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "name,age,id\n";
+        for (int i = 0; i < 1000; i++) out << "User" << i << ',' << 20 + i % 50 << ',' << i << '\n';
+    }
+    MutableArraySequence<User> loaded;
+    assert(Csv::Load(path, loaded) == 1000);
+    assert(loaded.GetLength() == 1000 && loaded.Get(999) == User("User999", 20 + 999 % 50, 999));
+    std::remove(path);
+    try {
+        Csv::Load(path, loaded);
+        assert(false);
+    }
+    catch (const Errors::RuntimeError& e) {
+        assert(e.Code() == ErrorCode::IO_ERROR);
+    }
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ScriptTest() {
+    std::cout << "Script tests: ";
+    std::istringstream script(
+        "# comment\n"
+        "new deque list int\n"
+        "push_back 1\n"
+        "push_front 0\n"
+        "\n"
+        "pop_back\n"
+        "show\n"
+        "new queue array professor\n"
+        "enqueue Kim 50 7 Algebra 1\n"
+        "enqueue Lee\n"
+        "size\n"
+        "use 0\n"
+        "size\n"
+        "dequeue\n");
+    std::ostringstream out;
+    ScriptStats stats = RunScript(script, out);
+    assert(stats.commands == 12 && stats.errors == 2);
+    assert(stats.timings["push_back"].count == 1 && stats.timings["size"].count == 2);
+    assert(out.str() ==
+        "1\n"
+        "[ 0 ]\n"
+        "line 10: error: Invalid argument: expected: name age id subject on_exam\n"
+        "1\n"
+        "1\n"
+        "line 14: error: Invalid argument: unknown command 'dequeue'\n");
+
+    ScriptOptions asList;
+    asList.overrideContainer = true;
+    asList.container = Container::LIST;
+    std::istringstream overridden("new stack array string\npush a\nlist\n");
+    std::ostringstream listOut;
+    assert(RunScript(overridden, listOut, asList).errors == 0);
+    assert(listOut.str() == "0: Stack<string>(list, size=1)\n");
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void TraceTest() {
+    std::cout << "Trace tests: ";
+    using namespace Tracing;
+    std::stringstream stream;
+    ListQueue<int> live;
+    {
+        TraceWriter<int> writer(stream, TraceKind::QUEUE);
+        RecordingQueue<int> recorded(live, writer);
+        for (int i = 1; i <= 100; i++) recorded.Enqueue(i);
+        assert(recorded.Dequeue() == 1 && recorded.Front() == 2 && recorded.Back() == 100);
+        assert(recorded.TryDequeue().HasValue() && recorded.GetLength() == 98);
+        assert(writer.GetRecorded() == 104);
+        ArrayStack<int> other;
+        try {
+            RecordingStack<int> wrongKind(other, writer);
+            assert(false);
+        }
+        catch (const Errors::InvalidArgumentError&) {}
+        writer.Finish();
+    }
+    Trace<int> trace = ReadTrace<int>(stream);
+    assert(trace.kind == TraceKind::QUEUE && trace.events.GetLength() == 104);
+    assert(trace.events.Get(3).op == TraceOp::Enqueue && trace.events.Get(3).item == 4);
+
+    CountingResource memory;
+    ArrayQueue<int> replayed(&memory);
+    ReplayReport report = Replay(trace, replayed, &memory);
+    assert(report.operations == 104 && report.failures == 0);
+    assert(report.checksum == 1 + 2 + 100 + 2 && report.peakBytes >= 100 * sizeof(int) && report.allocations > 0);
+    assert(replayed.GetLength() == live.GetLength() && replayed.Front() == 3);
+
+    ArrayStack<int> stack;
+    try {
+        Replay(trace, stack);
+        assert(false);
+    }
+    catch (const Errors::InvalidArgumentError&) {}
+
+    GeneratorOptions options;
+    options.operations = 20000;
+    options.maxBurst = 256;
+    for (TraceKind kind : { TraceKind::STACK, TraceKind::QUEUE, TraceKind::DEQUE }) {
+        Trace<int> generated = GenerateTrace<int>(kind, options);
+        assert(generated.events.GetLength() == options.operations);
+        if (kind == TraceKind::DEQUE) {
+            // Each burst stays on one end.
+            TraceOp burstOp = TraceOp::End;
+            int switches = 0;
+            for (int i = 0; i < generated.events.GetLength(); i++) {
+                TraceOp op = generated.events.Get(i).op;
+                if (op == TraceOp::Front || op == TraceOp::Back) continue;
+                bool sameKind = (op == TraceOp::PushFront || op == TraceOp::PushBack) == (burstOp == TraceOp::PushFront || burstOp == TraceOp::PushBack);
+                if (sameKind && op != burstOp) switches++;
+                burstOp = op;
+            }
+            assert(switches == 0);
+        }
+        std::stringstream file;
+        WriteTrace(file, generated);
+        Trace<int> loaded = ReadTrace<int>(file);
+        assert(loaded.events.GetLength() == options.operations);
+
+        ReplayReport onArray, onList;
+        if (kind == TraceKind::STACK) {
+            ArrayStack<int> a;
+            ListStack<int> l;
+            onArray = Replay(loaded, a);
+            onList = Replay(loaded, l);
+        }
+        else if (kind == TraceKind::QUEUE) {
+            ArrayQueue<int> a;
+            ListQueue<int> l;
+            onArray = Replay(loaded, a);
+            onList = Replay(loaded, l);
+        }
+        else {
+            ArrayDeque<int> a;
+            ListDeque<int> l;
+            onArray = Replay(loaded, a);
+            onList = Replay(loaded, l);
+        }
+        assert(onArray.failures == 0 && onList.failures == 0);
+        assert(onArray.checksum == onList.checksum && onArray.p50Ns <= onArray.maxNs);
+    }
+
+    std::stringstream garbage("not a trace at all");
+    try {
+        ReadTrace<int>(garbage);
+        assert(false);
+    }
+    catch (const Errors::InvalidArgumentError&) {}
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void DumpTest() {
+    std::cout << "Dump tests: ";
+    MutableListSequence<int> list;
+    for (int i = 0; i < 10; i++) list.Append(i * 11 - 20);
+    std::ostringstream out;
+    Dump::Write(out, list);
+    assert(out.str() == "[ -20 -9 2 13 24 35 46 57 68 79 ]\n");
+
+    out.str("");
+    Dump::Write(out, list, { 3, 2 });
+    assert(out.str() == "[ 13 24 ] (items 3-4 of 10)\n");
+    out.str("");
+    Dump::Write(out, list, { 8 });
+    assert(out.str() == "[ 68 79 ] (items 8-9 of 10)\n");
+    out.str("");
+    Dump::Write(out, list, { 20, 5 });
+    assert(out.str() == "[ ] (items 10-10 of 10)\n");
+    try {
+        Dump::Write(out, list, { -1, 5 });
+        assert(false);
+    }
+    catch (const Errors::InvalidArgumentError&) {}
+
+    MutableArraySequence<double> doubles;
+    doubles.Append(0.1);
+    doubles.Append(2.5);
+    doubles.Append(1.0 / 3);
+    doubles.Append(1e20);
+    std::ostringstream viaDump, viaStream;
+    Dump::Write(viaDump, doubles);
+    viaStream << "[ ";
+    for (int i = 0; i < doubles.GetLength(); i++) viaStream << doubles.Get(i) << " ";
+    viaStream << "]\n";
+    assert(viaDump.str() == viaStream.str());
+
+    MutableArraySequence<Student> students;
+    students.Append(Student("Ann", 19, 1, "B-12", true));
+    students.Append(Student("Bob", 20, 2, "B-13", false));
+    MutableListSequence<Professor> professors;
+    professors.Append(Professor("Kim", 50, 7, "Algebra", true));
+    MutableArraySequence<User> users;
+    users.Append(User("Eve", 30, 3));
+    MutableArraySequence<std::string> strings;
+    strings.Append("a b");
+    strings.Append("c");
+    viaDump.str("");
+    viaStream.str("");
+    Dump::Write(viaDump, students);
+    Dump::Write(viaDump, professors);
+    Dump::Write(viaDump, users);
+    Dump::Write(viaDump, strings);
+    viaStream << "[ " << students.Get(0) << " " << students.Get(1) << " ]\n"
+        << "[ " << professors.Get(0) << " ]\n"
+        << "[ " << users.Get(0) << " ]\n"
+        << "[ a b c ]\n";
+    assert(viaDump.str() == viaStream.str());
+
+    MutableArraySequence<int> big;
+    for (int i = 0; i < 100000; i++) big.Append(i);
+    out.str("");
+    Dump::Write(out, big);
+    std::string text = out.str();
+    assert(text.size() > 64 * 1024 && text.compare(0, 8, "[ 0 1 2 ") == 0);
+    assert(text.compare(text.size() - 9, 9, " 99999 ]\n") == 0);
+
+    std::istringstream script(
+        "new queue list int\n"
+        "enqueue 5\nenqueue 6\nenqueue 7\n"
+        "show 1\n"
+        "show 0 1\n"
+        "show -1\n");
+    std::ostringstream scriptOut;
+    ScriptStats stats = RunScript(script, scriptOut);
+    assert(stats.errors == 1);
+    assert(scriptOut.str() ==
+        "[ 6 7 ] (items 1-2 of 3)\n"
+        "[ 5 ] (items 0-0 of 3)\n"
+        "line 7: error: Invalid argument: negative offset\n");
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ConcurrentAppendTest() {
+    std::cout << "ConcurrentAppendSequence tests: ";
+    using Ordering = ConcurrentAppendSequence<int>::Ordering;
+    {
+        ConcurrentAppendSequence<std::string> seq(3, ConcurrentAppendSequence<std::string>::Ordering::ORDERED, 4);
+        assert(seq.GetLength() == 0 && seq.Snapshot().GetLength() == 0);
+        for (int i = 0; i < 50; i++) seq.Append(std::to_string(i));
+        MutableArraySequence<std::string> snapshot = seq.Snapshot();
+        assert(seq.GetLength() == 50 && snapshot.GetLength() == 50);
+        for (int i = 0; i < 50; i++) assert(snapshot.Get(i) == std::to_string(i));
+    }
+    try {
+        ConcurrentAppendSequence<int> bad(2, Ordering::UNORDERED, 0);
+        assert(false);
+    }
+    catch (const Errors::InvalidArgumentError&) {}
+
+    const int threads = 4, perThread = 20000;
+    for (Ordering ordering : { Ordering::UNORDERED, Ordering::ORDERED }) {
+        ConcurrentAppendSequence<int> seq(2, ordering, 100);
+        std::atomic<bool> done(false);
+        std::atomic<int> snapshotsChecked(0);
+
+        // Snapshots never repeat an item; ordered ones hold, for every
+        // thread, a prefix of what it appended and in order.
+        std::thread reader([&] {
+            DynamicArray<int> seen(threads * perThread);
+            do {
+                MutableArraySequence<int> snapshot = seq.Snapshot();
+                int next[threads] = {};
+                for (int i = 0; i < seen.GetSize(); i++) seen[i] = 0;
+                for (int i = 0; i < snapshot.GetLength(); i++) {
+                    int value = snapshot.Get(i);
+                    assert(seen[value]++ == 0);
+                    if (ordering == Ordering::ORDERED) assert(value % perThread == next[value / perThread]++);
+                }
+                snapshotsChecked++;
+            } while (!done.load());
+        });
+
+        std::vector<std::thread> writers;
+        for (int t = 0; t < threads; t++)
+            writers.emplace_back([&seq, t] {
+                for (int i = 0; i < perThread; i++) seq.Append(t * perThread + i);
+            });
+        for (std::thread& writer : writers) writer.join();
+        done = true;
+        reader.join();
+        assert(snapshotsChecked > 0);
+
+        MutableArraySequence<int> all = seq.Snapshot();
+        assert(seq.GetLength() == threads * perThread && all.GetLength() == threads * perThread);
+        DynamicArray<int> seen(threads * perThread);
+        for (int i = 0; i < seen.GetSize(); i++) seen[i] = 0;
+        for (int i = 0; i < all.GetLength(); i++) seen[all.Get(i)]++;
+        for (int i = 0; i < seen.GetSize(); i++) assert(seen[i] == 1);
+    }
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void ConcurrentArraySequenceTest() {
+    std::cout << "ConcurrentArraySequence tests: ";
+    using Mode = ConcurrentArraySequence<int>::Mode;
+    for (Mode mode : { Mode::SEQLOCK, Mode::RCU }) {
+        ConcurrentArraySequence<int> seq(mode, 2);
+        MutableArraySequence<int> model;
+        assert(seq.GetLength() == 0 && !seq.TryGetFirst() && seq.TryGetLast().Code() == ErrorCode::EMPTY_ARRAY);
+        for (int i = 0; i < 100; i++) {
+            seq.Append(i);
+            model.Append(i);
+        }
+        seq.Prepend(-1);
+        model.Prepend(-1);
+        seq.InsertAt(500, 50);
+        model.InsertAt(500, 50);
+        seq.Set(3, 300);
+        model.At(3) = 300;
+        seq.Remove(10);
+        model.Remove(10);
+        assert(seq.GetLength() == model.GetLength());
+        for (int i = 0; i < model.GetLength(); i++) assert(seq.Get(i) == model.Get(i));
+        assert(seq.GetFirst() == -1 && seq.GetLast() == 99 && seq.TryGet(1000).Code() == ErrorCode::INDEX_OUT_OF_RANGE);
+
+        MutableArraySequence<int> slice = seq.GetSubsequence(40, 60);
+        assert(slice.GetLength() == 21);
+        for (int i = 0; i < 21; i++) assert(slice.Get(i) == model.Get(40 + i));
+        MutableArraySequence<int> all = seq.Snapshot();
+        assert(all.GetLength() == model.GetLength() && all.Get(50) == model.Get(50));
+
+        try {
+            seq.Get(-1);
+            assert(false);
+        }
+        catch (const Errors::OutOfRangeError&) {}
+        try {
+            seq.GetSubsequence(5, 1000);
+            assert(false);
+        }
+        catch (const Errors::BaseError& e) { assert(e.Code() == ErrorCode::INVALID_INDICES); }
+
+        seq.Resize(120);
+        assert(seq.GetLength() == 120 && seq.Get(119) == 0);
+        seq.Resize(5);
+        assert(seq.GetLength() == 5 && seq.GetLast() == 3);
+        seq.Clear();
+        assert(seq.GetLength() == 0);
+    }
+
+    // Every committed state has a == b in every item and the same value in
+    // all items; a torn read or a freed buffer shows up as a mismatch.
+    struct Pair {
+        long long a, b;
+    };
+    using PairMode = ConcurrentArraySequence<Pair>::Mode;
+    for (PairMode mode : { PairMode::SEQLOCK, PairMode::RCU }) {
+        ConcurrentArraySequence<Pair> seq(mode, 1);
+        seq.Append({ 0, 0 });
+        std::atomic<bool> done(false);
+        std::atomic<long long> reads(0);
+
+        std::vector<std::thread> readers;
+        for (int r = 0; r < 3; r++)
+            readers.emplace_back([&seq, &done, &reads, r] {
+                while (!done.load()) {
+                    if (r == 0) {
+                        MutableArraySequence<Pair> snapshot = seq.Snapshot();
+                        assert(snapshot.GetLength() > 0);
+                        for (int i = 0; i < snapshot.GetLength(); i++)
+                            assert(snapshot.Get(i).a == snapshot.Get(i).b && snapshot.Get(i).a == snapshot.Get(0).a);
+                    }
+                    else {
+                        int length = seq.GetLength();
+                        Pair item = seq.Get(length > 1 ? length / r - 1 : 0);
+                        assert(item.a == item.b);
+                    }
+                    reads++;
+                }
+            });
+
+        DynamicArray<Pair> fill(0);
+        for (long long v = 1; v <= 3000; v++) {
+            if (v % 3 == 0) {
+                int length = seq.GetLength();
+                Pair last = seq.GetLast();
+                seq.Append(last);
+                assert(seq.GetLength() == length + 1);
+            }
+            else {
+                int count = int(v / 3 + 1);
+                fill.Resize(count);
+                for (int i = 0; i < count; i++) fill[i] = { v, v };
+                seq.Assign(fill.Data(), count);
+            }
+        }
+        while (reads.load() < 100) std::this_thread::yield();
+        done = true;
+        for (std::thread& reader : readers) reader.join();
+        assert(seq.GetLength() == 1001 && seq.GetFirst().a == 2999 && seq.GetLast().a == 2999);
+    }
+
+    std::cout << "all tests were completed successfully.\n";
+}
+
+void StudentTableTimeTest(int count = 1000000) {
+    MutableArraySequence<Student> roster;
+    StudentTable table;
+    table.Reserve(count);
+    for (int i = 0; i < count; i++) {
+        Student s("Student", 17 + i % 10, i, i % 3 == 0 ? "A23-564" : "B24-511", i % 4 != 0);
+        roster.Append(s);
+        table.Append(s);
+    }
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    int rowsPassed = 0;
+    for (int i = 0; i < roster.GetLength(); i++)
+        if (roster.At(i).exam_pass && roster.At(i).group == "A23-564") rowsPassed++;
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Array of Student passed-in-group scan time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    int columnPassed = table.PassedRowsInGroup("A23-564").GetLength();
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "StudentTable passed-in-group scan time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    int passed = table.CountPassed();
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "StudentTable CountPassed time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    assert(rowsPassed == columnPassed && passed >= columnPassed);
+    std::cout << std::endl;
+}
+
+void KernelsTimeTest(int count = 1 << 24) {
+    MutableArraySequence<int> seq;
+    for (int i = 0; i < count; i++) seq.Append(i % 1000 - 500);
+    const Sequence<int>* erased = &seq;
+    double megabytes = count * sizeof(int) / 1e6;
+    const char* level = Simd::ActiveLevel() == Simd::Level::AVX2 ? "AVX2" : Simd::ActiveLevel() == Simd::Level::SSE4 ? "SSE4.1" : "scalar";
+
+    auto report = [&](const char* name, auto kernel) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        long long result = kernel();
+        auto t2 = std::chrono::high_resolution_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+        std::cout << name << ": " << ms << " ms, " << megabytes / ms << " GB/s" << std::endl;
+        return result;
+    };
+
+    long long loopSum = report("Get loop Sum", [&] {
+        long long sum = 0;
+        for (int i = 0; i < erased->GetLength(); i++) sum += erased->Get(i);
+        return sum;
+    });
+    long long scalarSum = report("Scalar Sum", [&] { return Simd::Scalar::Sum(seq.Data(), count); });
+    std::cout << level << " ";
+    long long simdSum = report("Sum", [&] { return Kernels::Sum(seq); });
+
+    long long loopCount = report("Get loop CountIf(< 0)", [&] {
+        int negative = 0;
+        for (int i = 0; i < erased->GetLength(); i++)
+            if (erased->Get(i) < 0) negative++;
+        return negative;
+    });
+    long long scalarCount = report("Scalar CountIf(< 0)", [&] { return Simd::Scalar::CountIf(seq.Data(), count, Simd::Compare::LESS, 0); });
+    std::cout << level << " ";
+    long long simdCount = report("CountIf(< 0)", [&] { return Kernels::CountIf(seq, Kernels::Compare::LESS, 0); });
+
+    long long scalarMax = report("Scalar Max", [&] { return Simd::Scalar::Max(seq.Data(), count); });
+    std::cout << level << " ";
+    long long simdMax = report("Max", [&] { return Kernels::Max(seq); });
+
+    assert(loopSum == scalarSum && scalarSum == simdSum);
+    assert(loopCount == scalarCount && scalarCount == simdCount);
+    assert(scalarMax == simdMax);
+    std::cout << std::endl;
+}
+
+// Runs 10^6, 10^7 and 10^8 ints. The 10^8 step holds the input, the mapped
+// long longs and the filtered copy at once, about 1.4 GB; pass a smaller
+// maxCount on machines with less memory.
+void ParallelTimeTest(int maxCount = 100000000) {
+    int cores = std::max(1, (int)std::thread::hardware_concurrency());
+    for (int count = 1000000; count <= maxCount; count *= 10) {
+        MutableArraySequence<int> seq(count);
+        for (int i = 0; i < count; i++) seq.At(i) = i % 1000;
+
+        for (int threads = 1; ; threads = std::min(threads * 2, cores)) {
+            ThreadPool pool(threads);
+            auto t1 = std::chrono::high_resolution_clock::now();
+            MutableArraySequence<long long> mapped = Parallel::Map(seq, [](int x) { return (long long)x * 3 + 1; }, pool);
+            auto t2 = std::chrono::high_resolution_clock::now();
+            MutableArraySequence<int> filtered = Parallel::Where(seq, [](int x) { return x % 3 == 0; }, pool);
+            auto t3 = std::chrono::high_resolution_clock::now();
+            long long sum = Parallel::Reduce<long long>(mapped, 0, [](long long a, long long b) { return a + b; }, pool);
+            auto t4 = std::chrono::high_resolution_clock::now();
+
+            std::cout << count << " ints, " << threads << " threads: Map " << std::chrono::duration<double, std::milli>(t2 - t1).count()
+                << " ms, Where " << std::chrono::duration<double, std::milli>(t3 - t2).count()
+                << " ms, Reduce " << std::chrono::duration<double, std::milli>(t4 - t3).count() << " ms" << std::endl;
+            assert(filtered.GetLength() > 0 && sum > 0);
+            if (threads == cores) break;
+        }
+    }
+    std::cout << std::endl;
+}
+
+void ViewTimeTest(int count = 1000000) {
+    MutableArraySequence<int> first(count);
+    MutableArraySequence<int> second(count / 10);
+    for (int i = 0; i < count; i++) first.At(i) = i % 1000;
+    for (int i = 0; i < count / 10; i++) second.At(i) = i;
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    Sequence<int>* sub = first.GetSubsequence(100, count - 101);
+    MutableArraySequence<int> filtered;
+    for (int i = 0; i < sub->GetLength(); i++)
+        if (sub->Get(i) % 3 == 0) filtered.Append(sub->Get(i));
+    MutableArraySequence<int> mapped;
+    for (int i = 0; i < filtered.GetLength(); i++) mapped.Append(filtered.Get(i) * 2 + 1);
+    Sequence<int>* eager = mapped.Concat(&second);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Eager Subsequence/filter/map/Concat time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    MutableArraySequence<int> fused = View::From(first).Slice(100, count - 101)
+        .Where([](int x) { return x % 3 == 0; })
+        .Map([](int x) { return x * 2 + 1; })
+        .Concat(View::From(second))
+        .ToArraySequence();
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Fused View pipeline time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    long long sum = View::From(first).Slice(100, count - 101)
+        .Where([](int x) { return x % 3 == 0; })
+        .Map([](int x) { return x * 2 + 1; })
+        .Concat(View::From(second))
+        .Reduce(0LL, [](long long a, int b) { return a + b; });
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Fused View pipeline Reduce time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    long long eagerSum = 0;
+    for (int i = 0; i < eager->GetLength(); i++) eagerSum += eager->Get(i);
+    assert(eager->GetLength() == fused.GetLength() && eagerSum == sum);
+    delete sub;
+    delete eager;
+    std::cout << std::endl;
+}
+
+void SortTimeTest(int count = 1000000) {
+    MutableArraySequence<Student> students;
+    unsigned seed = 777;
+    for (int i = 0; i < count; i++) {
+        seed = seed * 1103515245u + 12345u;
+        students.Append(Student("Student", 17 + int(seed >> 16) % 10, int(seed >> 4) % count, "A23-564", true));
+    }
+    auto byId = [](const Student& a, const Student& b) { return a.id < b.id || (a.id == b.id && a.age < b.age); };
+
+    MutableArraySequence<Student> exported(students);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    std::vector<Student> vec;
+    for (int i = 0; i < exported.GetLength(); i++) vec.push_back(exported.Get(i));
+    std::sort(vec.begin(), vec.end(), byId);
+    for (int i = 0; i < exported.GetLength(); i++) exported.At(i) = vec[i];
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Export to std::vector, std::sort, reimport time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    MutableArraySequence<Student> intro(students);
+    t1 = std::chrono::high_resolution_clock::now();
+    Sorting::IntroSort(intro.Data(), intro.GetLength(), byId);
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Sequential IntroSort time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    MutableArraySequence<Student> sorted(students);
+    t1 = std::chrono::high_resolution_clock::now();
+    sorted.Sort(byId);
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Sort by id/age (" << DefaultPool().GetThreadCount() << " threads) time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    MutableArraySequence<Student> radix(students);
+    t1 = std::chrono::high_resolution_clock::now();
+    radix.SortByKey([](const Student& s) { return s.age; });
+    radix.SortByKey([](const Student& s) { return s.id; });
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Radix SortByKey age, then id time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    MutableListSequence<Student> list;
+    for (int i = 0; i < students.GetLength(); i++) list.Append(students.At(i));
+    t1 = std::chrono::high_resolution_clock::now();
+    list.Sort(byId);
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "List merge sort time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    for (int i = 0; i < count; i += count / 100 + 1) {
+        assert(exported.At(i) == sorted.At(i) && exported.At(i) == intro.At(i));
+        assert(exported.At(i).id == radix.At(i).id && exported.At(i).age == radix.At(i).age);
+    }
+    assert(list.GetFirst() == exported.GetFirst() && list.GetLast() == exported.GetLast());
+    std::cout << std::endl;
+}
+
+void HashIndexTimeTest(int count = 100000, int lookups = 100000) {
+    auto byId = [](const Student& s) { return s.id; };
+    MutableArraySequence<Student> plain;
+    IndexedArraySequence<Student, decltype(byId)> indexed(byId);
+    for (int i = 0; i < count; i++) {
+        Student s("Student", 17 + i % 10, (i * 7919) % count, "A23-564", true);
+        plain.Append(s);
+        indexed.Append(s);
+    }
+
+    int scanLookups = lookups / 100 + 1;
+    long long found = 0;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < scanLookups; q++) {
+        int id = (q * 31) % count;
+        for (int i = 0; i < plain.GetLength(); i++)
+            if (plain.Get(i).id == id) {
+                found += i;
+                break;
+            }
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Linear Get scan per lookup (us): " << std::chrono::duration<double, std::micro>(t2 - t1).count() / scanLookups << std::endl;
+
+    long long indexedFound = 0;
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < lookups; q++) {
+        int position = indexed.Find((q * 31) % count);
+        if (q < scanLookups) indexedFound += position;
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "HashIndex Find per lookup (us): " << std::chrono::duration<double, std::micro>(t2 - t1).count() / lookups << std::endl;
+
+    assert(found == indexedFound);
+    std::cout << std::endl;
+}
+
+void TreapSequenceTimeTest(int count = 100000) {
+    auto run = [](Sequence<int>* seq, const char* name, int count) {
+        unsigned seed = 7;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < count; i++) {
+            seed = seed * 1103515245u + 12345u;
+            seq->InsertAt(i, int(seed >> 8) % (seq->GetLength() + 1));
+        }
+        long long sum = 0;
+        for (int i = 0; i < count; i++) {
+            seed = seed * 1103515245u + 12345u;
+            sum += seq->Get(int(seed >> 8) % seq->GetLength());
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        std::cout << name << " random InsertAt + Get time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+        return sum;
+    };
+
+    MutableArraySequence<int> array;
+    MutableListSequence<int> list;
+    TreapSequence<int> treap;
+    long long arraySum = run(&array, "MutableArraySequence", count);
+    run(&list, "MutableListSequence (count / 10)", count / 10);
+    long long treapSum = run(&treap, "TreapSequence", count);
+    assert(arraySum == treapSum);
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        TreapSequence<int>* tail = treap.SplitAt(treap.GetLength() / 3);
+        tail->ConcatInPlace(treap);
+        treap.ConcatInPlace(*tail);
+        delete tail;
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "TreapSequence 1000 x SplitAt + ConcatInPlace time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+    std::cout << std::endl;
+}
+
+void GapBufferSequenceTimeTest(int count = 100000, int edits = 200000) {
+    // Cursor-editing trace: mostly typing and backspacing at the cursor, with
+    // short cursor moves and an occasional jump.
+    auto run = [](Sequence<int>* seq, const char* name, int count, int edits) {
+        for (int i = 0; i < count; i++) seq->Append(i);
+        unsigned seed = 7;
+        int cursor = count / 2;
+        long long sum = 0;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < edits; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int op = int(seed >> 8) % 100;
+            int length = seq->GetLength();
+            if (op < 60) {
+                seq->InsertAt(i, cursor++);
+            }
+            else if (op < 85) {
+                if (cursor > 0) seq->Remove(--cursor);
+            }
+            else if (op < 99) {
+                cursor += int(seed >> 16) % 17 - 8;
+                cursor = cursor < 0 ? 0 : cursor > length ? length : cursor;
+            }
+            else {
+                cursor = int(seed >> 12) % (length + 1);
+            }
+            if (cursor < seq->GetLength()) sum += seq->Get(cursor);
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        std::cout << name << " cursor trace time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+        return sum;
+    };
+
+    MutableArraySequence<int> array;
+    MutableListSequence<int> list;
+    GapBufferSequence<int> buffer;
+    long long arraySum = run(&array, "MutableArraySequence", count, edits);
+    run(&list, "MutableListSequence (edits / 10)", count, edits / 10);
+    long long bufferSum = run(&buffer, "GapBufferSequence", count, edits);
+    assert(arraySum == bufferSum);
+    std::cout << std::endl;
+}
+
+void StaticContainersTimeTest(int requests = 1000000) {
+    // Per-request scratch: each request builds a small stack and queue, fills
+    // them and drains them again.
+    auto run = [requests](auto makeStack, auto makeQueue, const char* name) {
+        long long sum = 0;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < requests; r++) {
+            auto stack = makeStack();
+            auto queue = makeQueue();
+            for (int i = 0; i < 16; i++) {
+                stack.Push(r + i);
+                queue.Enqueue(r - i);
+            }
+            while (!stack.IsEmpty()) sum += stack.Pop();
+            while (!queue.IsEmpty()) sum += queue.Dequeue();
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        std::cout << name << " time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+        return sum;
+    };
+
+    long long arraySum = run([] { return ArrayStack<int>(); }, [] { return ArrayQueue<int>(); }, "ArrayStack + ArrayQueue");
+    long long listSum = run([] { return ListStack<int>(); }, [] { return ListQueue<int>(); }, "ListStack + ListQueue");
+    long long staticSum = run([] { return StaticStack<int, 16>(); }, [] { return StaticQueue<int, 16>(); }, "StaticStack + StaticQueue");
+    assert(arraySum == listSum && arraySum == staticSum);
+    std::cout << std::endl;
+}
+
+void SmallBufferTimeTest(int count = 1000000) {
+    // Many short-lived arrays of a few items, grown the way
+    // MutableArraySequence grows its storage.
+    auto run = [count](auto make, const char* name) {
+        long long sum = 0;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < count; r++) {
+            auto arr = make();
+            arr.Resize(10);
+            for (int i = 0; i < 10; i++) arr[i] = r + i;
+            arr.Resize(12);
+            arr[10] = arr[11] = r;
+            for (int i = 0; i < 12; i++) sum += arr[i];
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        std::cout << name << " time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+        return sum;
+    };
+
+    long long heapSum = run([] { return DynamicArray<int, Checked, 0>(0); }, "DynamicArray<int> without inline storage");
+    long long inlineSum = run([] { return DynamicArray<int>(0); }, "DynamicArray<int> with 16 inline items");
+    assert(heapSum == inlineSum);
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    long long stackSum = 0;
+    for (int r = 0; r < count; r++) {
+        ArrayStack<int> stack;
+        for (int i = 0; i < 12; i++) stack.Push(r + i);
+        while (!stack.IsEmpty()) stackSum += stack.Pop();
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "ArrayStack<int> with 12 items time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+    std::cout << std::endl;
+}
+
+void MemoryResourceTimeTest(int requests = 10000, int items = 1000) {
+    // Per-request containers: build a list and an array, then drop them.
+    auto run = [requests, items](auto makeResource, auto releaseResource, const char* name) {
+        long long sum = 0;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < requests; r++) {
+            std::pmr::memory_resource* resource = makeResource();
+            {
+                MutableListSequence<int> list(resource);
+                MutableArraySequence<int> array(resource);
+                for (int i = 0; i < items; i++) {
+                    list.Append(i);
+                    array.Append(r);
+                }
+                sum += list.GetLast() + array.GetLast();
+            }
+            releaseResource();
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        std::cout << name << " time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+        return sum;
+    };
+
+    ArenaResource arena(64 * 1024);
+    PoolResource pool;
+    long long defaultSum = run([] { return std::pmr::get_default_resource(); }, [] {}, "Default resource");
+    long long poolSum = run([&pool] { return &pool; }, [] {}, "PoolResource");
+    long long arenaSum = run([&arena] { return &arena; }, [&arena] { arena.Release(); }, "ArenaResource, released per request");
+    assert(defaultSum == poolSum && defaultSum == arenaSum);
+    std::cout << std::endl;
+}
+
+void MmapDynamicArrayTimeTest(int count = 10000000) {
+    const char* textPath = "MmapDynamicArrayTimeTest.txt";
+    const char* mappedPath = "MmapDynamicArrayTimeTest.seq";
+    {
+        std::ofstream text(textPath);
+        MmapDynamicArray<int> mapped(mappedPath, nullptr, 0);
+        mapped.Resize(count);
+        for (int i = 0; i < count; i++) {
+            text << i << '\n';
+            mapped[i] = i;
+        }
+    }
+
+    long long textSum = 0;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    {
+        std::ifstream text(textPath);
+        MutableArraySequence<int> loaded;
+        int value;
+        while (text >> value) loaded.Append(value);
+        for (int i = 0; i < loaded.GetLength(); i++) textSum += loaded.Get(i);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Text reload and sum time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    long long mappedSum = 0;
+    t1 = std::chrono::high_resolution_clock::now();
+    {
+        MutableArraySequence<int, Checked, MmapDynamicArray<int>> loaded(MmapDynamicArray<int>{ mappedPath });
+        t2 = std::chrono::high_resolution_clock::now();
+        std::cout << "MmapDynamicArray reopen time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+        for (int i = 0; i < loaded.GetLength(); i++) mappedSum += loaded.Get(i);
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "MmapDynamicArray reopen and sum time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    assert(textSum == mappedSum);
+    std::remove(textPath);
+    std::remove(mappedPath);
+    std::cout << std::endl;
+}
+
+void SerializeTimeTest(int count = 10000000, int studentCount = 1000000) {
+    auto elapsed = [](auto start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    };
+    const char* textPath = "SerializeTimeTest.txt";
+    const char* binaryPath = "SerializeTimeTest.seqb";
+
+    MutableArraySequence<int> numbers;
+    for (int i = 0; i < count; i++) numbers.Append(i);
+
+    auto t = std::chrono::high_resolution_clock::now();
+    {
+        std::ofstream text(textPath);
+        for (int i = 0; i < count; i++) text << numbers.Get(i) << '\n';
+    }
+    std::cout << "Text save of " << count << " ints time: " << elapsed(t) << std::endl;
+    t = std::chrono::high_resolution_clock::now();
+    Serialization::SaveFile(binaryPath, numbers);
+    std::cout << "Binary save time: " << elapsed(t) << std::endl;
+
+    t = std::chrono::high_resolution_clock::now();
+    {
+        std::ifstream text(textPath);
+        MutableArraySequence<int> loaded;
+        int value;
+        while (text >> value) loaded.Append(value);
+        assert(loaded.GetLength() == count);
+    }
+    std::cout << "Text load time: " << elapsed(t) << std::endl;
+    t = std::chrono::high_resolution_clock::now();
+    {
+        MutableArraySequence<int> loaded;
+        Serialization::LoadFile(binaryPath, loaded);
+        assert(loaded.GetLength() == count);
+    }
+    std::cout << "Binary load time: " << elapsed(t) << std::endl;
+    t = std::chrono::high_resolution_clock::now();
+    {
+        Serialization::MappedArray<int> mapped(binaryPath);
+        assert(mapped.GetLength() == count);
+        std::cout << "Mapped open time: " << elapsed(t) << std::endl;
+        assert(Kernels::Sum(mapped.Data(), mapped.GetLength()) == Kernels::Sum(numbers));
+    }
+    std::cout << "Mapped open and sum time: " << elapsed(t) << std::endl << std::endl;
+
+    MutableArraySequence<Student> students;
+    for (int i = 0; i < studentCount; i++)
+        students.Append(Student("Student" + std::to_string(i), 18 + i % 10, i, "G-" + std::to_string(i % 50), i % 3 != 0));
+
+    t = std::chrono::high_resolution_clock::now();
+    {
+        std::ofstream text(textPath);
+        for (int i = 0; i < studentCount; i++) {
+            const Student& s = students.At(i);
+            text << s.name << ' ' << s.age << ' ' << s.id << ' ' << s.group << ' ' << s.exam_pass << '\n';
+        }
+    }
+    std::cout << "Text save of " << studentCount << " students time: " << elapsed(t) << std::endl;
+    t = std::chrono::high_resolution_clock::now();
+    Serialization::SaveFile(binaryPath, students);
+    std::cout << "Binary save time: " << elapsed(t) << std::endl;
+
+    t = std::chrono::high_resolution_clock::now();
+    {
+        std::ifstream text(textPath);
+        MutableArraySequence<Student> loaded;
+        Student s;
+        while (text >> s.name >> s.age >> s.id >> s.group >> s.exam_pass) loaded.Append(s);
+        assert(loaded.GetLength() == studentCount);
+    }
+    std::cout << "Text load time: " << elapsed(t) << std::endl;
+    t = std::chrono::high_resolution_clock::now();
+    {
+        MutableArraySequence<Student> loaded;
+        Serialization::LoadFile(binaryPath, loaded);
+        assert(loaded.GetLength() == studentCount && loaded.GetLast() == students.GetLast());
+    }
+    std::cout << "Binary load time: " << elapsed(t) << std::endl;
+
+    std::remove(textPath);
+    std::remove(binaryPath);
+    std::cout << std::endl;
+}
+
+void CsvLoaderTimeTest(int count = 1000000) {
+    const char* path = "CsvLoaderTimeTest.csv";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "name,age,id,group,exam_pass\n";
+        for (int i = 0; i < count; i++)
+            out << "Student" << i << ',' << 18 + i % 10 << ',' << i << ",G-" << i % 50 << ',' << (i % 3 != 0) << '\n';
+    }
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    {
+        std::ifstream in(path);
+        MutableArraySequence<Student> roster;
+        std::string line, name, age, id, group, pass;
+        std::getline(in, line);
+        while (std::getline(in, line)) {
+            std::stringstream fields(line);
+            std::getline(fields, name, ',');
+            std::getline(fields, age, ',');
+            std::getline(fields, id, ',');
+            std::getline(fields, group, ',');
+            std::getline(fields, pass, ',');
+            roster.Append(Student(name, std::stoi(age), std::stoi(id), group, pass == "1"));
+        }
+        assert(roster.GetLength() == count);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "iostream CSV load of " << count << " students time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    {
+        MutableArraySequence<Student> roster;
+        assert(Csv::Load(path, roster) == count);
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Csv::Load into MutableArraySequence time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    {
+        MutableListSequence<Student> roster;
+        assert(Csv::Load(path, roster) == count);
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Csv::Load into MutableListSequence time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    {
+        Csv::MappedFile file(path);
+        Csv::Reader reader(file.Text(), ',');
+        Csv::Row row;
+        long long idSum = 0;
+        while (reader.Next(row)) if (row.GetLine() > 1) idSum += row.Int(2);
+        assert(idSum == (long long)count * (count - 1) / 2);
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Csv::Reader split only time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    std::remove(path);
+    std::cout << std::endl;
+}
+
+void ScriptTimeTest(int count = 200000) {
+    std::ostringstream trace;
+    trace << "new queue array int\n";
+    for (int i = 0; i < count; i++) {
+        trace << "enqueue " << i << "\n";
+        if (i % 4 == 3) trace << "dequeue\n";
+    }
+    trace << "size\n";
+    std::string text = trace.str();
+
+    for (Container backend : { Container::ARRAY, Container::LIST }) {
+        ScriptOptions options;
+        options.overrideContainer = true;
+        options.container = backend;
+        std::istringstream in(text);
+        std::ostringstream out;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        ScriptStats stats = RunScript(in, out, options);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        assert(stats.errors == 0);
+        std::cout << "Script replay on " << ToString(backend) << " queue time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+        PrintTimings(stats, std::cout);
+    }
+    std::cout << std::endl;
+}
+
+void TraceTimeTest(int operations = 200000) {
+    using namespace Tracing;
+    GeneratorOptions options;
+    options.operations = operations;
+
+    auto run = [](const char* name, auto& target, const Trace<int>& trace, CountingResource& memory) {
+        std::cout << name << ": ";
+        PrintReport(Replay(trace, target, &memory), std::cout);
+    };
+
+    Trace<int> stackTrace = GenerateTrace<int>(TraceKind::STACK, options);
+    {
+        CountingResource a, l;
+        ArrayStack<int> arrayStack(&a);
+        ListStack<int> listStack(&l);
+        run("ArrayStack", arrayStack, stackTrace, a);
+        run("ListStack", listStack, stackTrace, l);
+    }
+    std::cout << std::endl;
+
+    Trace<int> queueTrace = GenerateTrace<int>(TraceKind::QUEUE, options);
+    {
+        CountingResource a, l;
+        ArrayQueue<int> arrayQueue(&a);
+        ListQueue<int> listQueue(&l);
+        run("ArrayQueue", arrayQueue, queueTrace, a);
+        run("ListQueue", listQueue, queueTrace, l);
+    }
+    std::cout << std::endl;
+
+    Trace<int> dequeTrace = GenerateTrace<int>(TraceKind::DEQUE, options);
+    {
+        CountingResource a, l;
+        ArrayDeque<int> arrayDeque(&a);
+        ListDeque<int> listDeque(&l);
+        run("ArrayDeque", arrayDeque, dequeTrace, a);
+        run("ListDeque", listDeque, dequeTrace, l);
+    }
+    std::cout << std::endl;
+}
+
+void DumpTimeTest(int count = 1000000, int naiveCount = 20000) {
+    ListQueue<int> queue;
+    for (int i = 0; i < count; i++) queue.Enqueue(i);
+    std::ostringstream out;
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    Dump::Write(out, queue);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Dump::Write, ListQueue of " << count << ": "
+        << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms, " << out.str().size() << " bytes\n";
+
+    out.str("");
+    t1 = std::chrono::high_resolution_clock::now();
+    Dump::Write(out, queue, { count / 2, 100 });
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Dump::Write, page of 100 from the middle: "
+        << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms\n";
+
+    ListQueue<int> small;
+    for (int i = 0; i < naiveCount; i++) small.Enqueue(i);
+    out.str("");
+    t1 = std::chrono::high_resolution_clock::now();
+    out << "[ ";
+    for (int i = 0; i < small.GetLength(); ++i) out << small.Get(i) << " ";
+    out << "]\n";
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Get(i) loop, ListQueue of " << naiveCount << ": "
+        << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms\n";
+
+    out.str("");
+    t1 = std::chrono::high_resolution_clock::now();
+    Dump::Write(out, small);
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "Dump::Write, ListQueue of " << naiveCount << ": "
+        << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms\n";
+}
+
+void ConcurrentAppendTimeTest(int count = 8000000) {
+    using Ordering = ConcurrentAppendSequence<int>::Ordering;
+    for (int threads : { 1, 2, 4, 8 }) {
+        int perThread = count / threads;
+        auto run = [threads](auto append) {
+            std::vector<std::thread> workers;
+            auto t1 = std::chrono::high_resolution_clock::now();
+            for (int t = 0; t < threads; t++) workers.emplace_back([&append, t] { append(t); });
+            for (std::thread& worker : workers) worker.join();
+            auto t2 = std::chrono::high_resolution_clock::now();
+            return std::chrono::duration<double, std::milli>(t2 - t1).count();
+        };
+
+        MutableArraySequence<int> locked;
+        std::mutex mutex;
+        double mutexMs = run([&](int t) {
+            for (int i = 0; i < perThread; i++) {
+                std::lock_guard<std::mutex> lock(mutex);
+                locked.Append(t * perThread + i);
+            }
+        });
+
+        ConcurrentAppendSequence<int> unordered(threads);
+        double unorderedMs = run([&](int t) {
+            for (int i = 0; i < perThread; i++) unordered.Append(t * perThread + i);
+        });
+
+        ConcurrentAppendSequence<int> ordered(threads, Ordering::ORDERED);
+        double orderedMs = run([&](int t) {
+            for (int i = 0; i < perThread; i++) ordered.Append(t * perThread + i);
+        });
+
+        auto t1 = std::chrono::high_resolution_clock::now();
+        MutableArraySequence<int> snapshot = unordered.Snapshot();
+        auto t2 = std::chrono::high_resolution_clock::now();
+        double snapshotMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+        t1 = std::chrono::high_resolution_clock::now();
+        MutableArraySequence<int> orderedSnapshot = ordered.Snapshot();
+        t2 = std::chrono::high_resolution_clock::now();
+        double orderedSnapshotMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+        std::cout << threads << " threads, " << count << " appends: mutex " << mutexMs << " ms, sharded "
+            << unorderedMs << " ms, ordered " << orderedMs << " ms; snapshot " << snapshotMs << " ms, ordered snapshot "
+            << orderedSnapshotMs << " ms\n";
+    }
+}
+
+void ConcurrentArraySequenceTimeTest(int size = 1 << 16, int readsPerThread = 2000000) {
+    using Mode = ConcurrentArraySequence<int>::Mode;
+    DynamicArray<int> initial(size);
+    for (int i = 0; i < size; i++) initial[i] = i;
+
+    // readers threads call read(index) while one writer calls write(index)
+    // with a yield in between; returns reads per second.
+    auto run = [size, readsPerThread](int threads, auto read, auto write) {
+        std::atomic<bool> done(false);
+        std::thread writer([&] {
+            for (int i = 0; !done.load(); i = (i + 7919) % size) {
+                write(i);
+                std::this_thread::yield();
+            }
+        });
+        std::vector<std::thread> readers;
+        std::atomic<long long> checksum(0);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (int t = 0; t < threads; t++)
+            readers.emplace_back([&, t] {
+                long long sum = 0;
+                unsigned index = unsigned(t) * 40503u;
+                for (int i = 0; i < readsPerThread; i++) {
+                    index = index * 1664525u + 1013904223u;
+                    sum += read(int(index % unsigned(size)));
+                }
+                checksum += sum;
+            });
+        for (std::thread& reader : readers) reader.join();
+        auto t2 = std::chrono::high_resolution_clock::now();
+        done = true;
+        writer.join();
+        double seconds = std::chrono::duration<double>(t2 - t1).count();
+        return double(threads) * readsPerThread / seconds / 1e6;
+    };
+
+    for (int threads : { 1, 2, 4, 8 }) {
+        MutableArraySequence<int> plain(initial.Data(), size);
+        std::mutex mutex;
+        double mutexRate = run(threads,
+            [&](int i) { std::lock_guard<std::mutex> lock(mutex); return plain.Get(i); },
+            [&](int i) { std::lock_guard<std::mutex> lock(mutex); plain.At(i)++; });
+
+        std::shared_mutex shared;
+        double sharedRate = run(threads,
+            [&](int i) { std::shared_lock<std::shared_mutex> lock(shared); return plain.Get(i); },
+            [&](int i) { std::unique_lock<std::shared_mutex> lock(shared); plain.At(i)++; });
+
+        ConcurrentArraySequence<int> seqlock(initial.Data(), size, Mode::SEQLOCK);
+        double seqlockRate = run(threads,
+            [&](int i) { return seqlock.Get(i); },
+            [&](int i) { seqlock.Set(i, i + 1); });
+
+        ConcurrentArraySequence<int> rcu(initial.Data(), size, Mode::RCU);
+        double rcuRate = run(threads,
+            [&](int i) { return rcu.Get(i); },
+            [&](int i) { rcu.Set(i, i + 1); });
+
+        std::cout << threads << " readers + 1 writer, Mreads/s: mutex " << mutexRate << ", shared_mutex " << sharedRate
+            << ", seqlock " << seqlockRate << ", rcu " << rcuRate << "\n";
+    }
+}
+
+void StaticDispatchTimeTest() {
+    const int count = 1000000;
+    ArrayStack<int> virtualStack;
+    CoreStack<ArrayCore<int>> staticStack;
+    for (int i = 0; i < count; i++) {
+        virtualStack.Push(i);
+        staticStack.Push(i);
+    }
+
+    Stack<int>* erased = &virtualStack;
+    long long sum = 0;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < count; i++) sum += erased->Get(i);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "ArrayStack Get loop time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < count; i++) sum -= staticStack.Get(i);
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "CoreStack Get loop time: " << std::chrono::duration<double, std::milli>(t2 - t1).count() << std::endl;
+
+    assert(sum == 0);
+    std::cout << std::endl;
+}
+
+void TimeTest() {
+    ArrayStack<int> as;
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        as.Push(i);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    double time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ArrayStack Push time: " << time_range << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        as.Pop();
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ArrayStack Pop time: " << time_range << std::endl << std::endl;
+
+
+    ListStack<int> ls;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        ls.Push(i);
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ListStack Push time: " << time_range << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        ls.Pop();
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ListStack Pop time: " << time_range << std::endl << std::endl;
+
+
+    ArrayQueue<int> aq;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        aq.Enqueue(i);
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ArrayQueue Enqueue time: " << time_range << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        aq.Dequeue();
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ArrayQueue Dequeue time: " << time_range << std::endl << std::endl;
+
+
+    ListQueue<int> lq;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        lq.Enqueue(i);
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ListQueue Enqueue time: " << time_range << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        lq.Dequeue();
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ListQueue Dequeue time: " << time_range << std::endl << std::endl;
+
+
+    ArrayDeque<int> ad;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        ad.PushFront(i);
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ArrayDeque PushFront time : " << time_range << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        ad.PopFront();
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ArrayDeque PopFront time : " << time_range << std::endl << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        ad.PushBack(i);
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ArrayDeque PushBack time : " << time_range << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        ad.PopBack();
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ArrayDeque PopBack time : " << time_range << std::endl << std::endl;
+
+
+    ListDeque<int> ld;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        ld.PushFront(i);
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ListDeque PushFront time : " << time_range << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        ld.PopFront();
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ListDeque PopFront time : " << time_range << std::endl << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        ld.PushBack(i);
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ListDeque PushBack time : " << time_range << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        ld.PopBack();
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+
+    time_range = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    std::cout << "ListDeque PopBack time : " << time_range << std::endl << std::endl;
+}
+
+void AllTests() {
+
+    DynamicArrayTest();
+    LinkedListTest();
+
+    ArraySequenceTest();
+    ListSequenceTest();
+
+    ArrayQueueTest();
+    ListQueueTest();
+
+    ArrayStackTest();
+    ListStackTest();
+
+    ArrayDequeTest();
+    ListDequeTest();
+
+    StudentTest();
+
+    TryApiTest();
+
+    ErrorTest();
+
+    BoundsPolicyTest();
+
+    StaticSequenceTest();
+
+    ReferenceAccessTest();
+
+    StudentTableTest();
+
+    StringPoolTest();
+
+    KernelsTest();
+
+    ParallelTest();
+
+    ViewTest();
+
+    SortTest();
+
+    HashIndexTest();
+
+    TreapSequenceTest();
+    GapBufferSequenceTest();
+    StaticContainersTest();
+    MemoryResourceTest();
+    MmapDynamicArrayTest();
+    SerializeTest();
+    CsvLoaderTest();
+    ScriptTest();
+    TraceTest();
+    DumpTest();
+    ConcurrentAppendTest();
+    ConcurrentArraySequenceTest();
 }
\ No newline at end of file